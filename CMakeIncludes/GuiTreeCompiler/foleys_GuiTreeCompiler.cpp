@@ -0,0 +1,77 @@
+/*
+ ==============================================================================
+    Copyright (c) 2021 - 2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+/*
+ Converts a GUI XML from the designer into the binary ValueTree format.
+ This is used by the CMake function pgm_add_binary_gui_tree().
+
+ Usage: foleys_gui_tree_compiler <input.xml> <output.bin>
+ */
+
+#include <juce_core/juce_core.h>
+#include <juce_data_structures/juce_data_structures.h>
+
+#include <iostream>
+
+int main (int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: foleys_gui_tree_compiler <input.xml> <output.bin>" << std::endl;
+        return 1;
+    }
+
+    const auto cwd    = juce::File::getCurrentWorkingDirectory();
+    const auto input  = cwd.getChildFile (juce::String::fromUTF8 (argv[1]));
+    const auto output = cwd.getChildFile (juce::String::fromUTF8 (argv[2]));
+
+    const auto tree = juce::ValueTree::fromXml (input.loadFileAsString());
+    if (! tree.isValid() || ! tree.hasType ("magic"))
+    {
+        std::cerr << "Not a valid GUI tree: " << input.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    output.getParentDirectory().createDirectory();
+    output.deleteFile();
+
+    juce::FileOutputStream stream (output);
+    if (stream.failedToOpen())
+    {
+        std::cerr << "Could not write " << output.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    tree.writeToStream (stream);
+    return 0;
+}
@@ -0,0 +1,165 @@
+# ==============================================================================
+# Copyright (c) 2023 Foleys Finest Audio - Daniel Walz
+# All rights reserved.
+#
+# **BSD 3-Clause License**
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+# 3. Neither the name of the copyright holder nor the names of its contributors
+# may be used to endorse or promote products derived from this software without
+# specific prior written permission.
+#
+# ==============================================================================
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+# IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+# INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+# OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+# OF THE POSSIBILITY OF SUCH DAMAGE.
+# ==============================================================================
+
+#[[
+
+PGMBinaryGuiTree
+----------------
+
+This module provides a function to convert the GUI XML saved from the designer into the binary
+ValueTree format at build time. Loading the binary format with MagicGUIState::setGuiValueTree()
+avoids parsing the XML and converting the strings for every instance of the plugin.
+
+The converter is a small JUCE console app, that is built from source the first time the
+function is used. When cross-compiling, it is built for the build host as external project from
+CMakeIncludes/GuiTreeCompiler. Alternatively set PGM_GUI_TREE_COMPILER to a prebuilt converter.
+
+]]
+
+include_guard (GLOBAL)
+
+set (PGM_GUI_TREE_COMPILER_DIR "${CMAKE_CURRENT_LIST_DIR}/GuiTreeCompiler")
+set (PGM_GUI_TREE_COMPILER "" CACHE FILEPATH "A prebuilt foleys_gui_tree_compiler for the build host")
+
+#[[
+Sets the variable named by out_var to the command that runs the converter, and out_depends to the
+target the custom commands need to depend on.
+]]
+function (_pgm_get_gui_tree_compiler out_var out_depends)
+
+	if (PGM_GUI_TREE_COMPILER)
+		set (${out_var} "${PGM_GUI_TREE_COMPILER}" PARENT_SCOPE)
+		set (${out_depends} "" PARENT_SCOPE)
+		return ()
+	endif ()
+
+	if (CMAKE_CROSSCOMPILING)
+		set (host_binary_dir "${CMAKE_BINARY_DIR}/foleys_gui_tree_compiler_host")
+		set (host_compiler "${host_binary_dir}/bin/foleys_gui_tree_compiler")
+
+		if (CMAKE_HOST_WIN32)
+			string (APPEND host_compiler ".exe")
+		endif ()
+
+		if (NOT TARGET foleys_gui_tree_compiler_host)
+			if (JUCE_SOURCE_DIR)
+				set (juce_dir "${JUCE_SOURCE_DIR}")
+			else ()
+				set (juce_dir "${juce_SOURCE_DIR}")
+			endif ()
+
+			include (ExternalProject)
+
+			# no toolchain file is forwarded, so the converter is built for the build host
+			ExternalProject_Add (foleys_gui_tree_compiler_host
+				SOURCE_DIR "${PGM_GUI_TREE_COMPILER_DIR}"
+				BINARY_DIR "${host_binary_dir}"
+				CMAKE_ARGS -DPGM_JUCE_SOURCE_DIR=${juce_dir} -DCMAKE_BUILD_TYPE=Release
+				BUILD_COMMAND ${CMAKE_COMMAND} --build <BINARY_DIR> --config Release
+				BUILD_BYPRODUCTS "${host_compiler}"
+				INSTALL_COMMAND "")
+		endif ()
+
+		set (${out_var} "${host_compiler}" PARENT_SCOPE)
+		set (${out_depends} foleys_gui_tree_compiler_host PARENT_SCOPE)
+		return ()
+	endif ()
+
+	if (NOT TARGET foleys_gui_tree_compiler)
+		juce_add_console_app (foleys_gui_tree_compiler PRODUCT_NAME "foleys_gui_tree_compiler")
+
+		target_sources (foleys_gui_tree_compiler PRIVATE "${PGM_GUI_TREE_COMPILER_DIR}/foleys_GuiTreeCompiler.cpp")
+
+		target_compile_definitions (foleys_gui_tree_compiler
+			PRIVATE
+				JUCE_WEB_BROWSER=0
+				JUCE_USE_CURL=0)
+
+		target_link_libraries (foleys_gui_tree_compiler
+			PRIVATE
+				juce::juce_core
+				juce::juce_data_structures
+				juce::juce_recommended_config_flags)
+	endif ()
+
+	set (${out_var} foleys_gui_tree_compiler PARENT_SCOPE)
+	set (${out_depends} foleys_gui_tree_compiler PARENT_SCOPE)
+
+endfunction ()
+
+#[[
+
+  pgm_add_binary_gui_tree (<target>
+                           SOURCES <xmlFile> [<xmlFile>...])
+
+This function creates a binary data target like juce_add_binary_data, but each XML file is converted
+into the binary ValueTree format first. The resources are named after the XML file with the extension
+.bin, so Resources/magic.xml ends up as BinaryData::magic_bin.
+
+Example usage:
+
+ pgm_add_binary_gui_tree (Foo_gui SOURCES Resources/magic.xml)
+ target_link_libraries (Foo PRIVATE Foo_gui)
+
+ magicState.setGuiValueTree (BinaryData::magic_bin, BinaryData::magic_binSize);
+
+]]
+function (pgm_add_binary_gui_tree target)
+
+	cmake_parse_arguments (ARG "" "" "SOURCES" ${ARGN})
+
+	if (NOT ARG_SOURCES)
+		message (FATAL_ERROR "${CMAKE_CURRENT_FUNCTION} - no SOURCES given for ${target}!")
+	endif ()
+
+	_pgm_get_gui_tree_compiler (gui_tree_compiler gui_tree_compiler_depends)
+
+	set (binary_trees "")
+
+	foreach (source IN LISTS ARG_SOURCES)
+		get_filename_component (source_path "${source}" ABSOLUTE)
+		get_filename_component (source_name "${source}" NAME_WE)
+
+		set (binary_tree "${CMAKE_CURRENT_BINARY_DIR}/${target}/${source_name}.bin")
+
+		add_custom_command (
+			OUTPUT "${binary_tree}"
+			COMMAND "${gui_tree_compiler}" "${source_path}" "${binary_tree}"
+			DEPENDS ${gui_tree_compiler_depends} "${source_path}"
+			COMMENT "Converting ${source} into a binary GUI tree"
+			VERBATIM)
+
+		list (APPEND binary_trees "${binary_tree}")
+	endforeach ()
+
+	juce_add_binary_data ("${target}" SOURCES ${binary_trees})
+
+endfunction ()
@@ -66,6 +66,8 @@ find_dependency (JUCE 6)
 juce_add_module ("${CMAKE_CURRENT_LIST_DIR}"
                  ALIAS_NAMESPACE Foleys)
 
+include ("${CMAKE_CURRENT_LIST_DIR}/CMakeIncludes/PGMBinaryGuiTree.cmake")
+
 find_package_message ("${CMAKE_FIND_PACKAGE_NAME}" 
 					  "foleys_gui_magic - local install"
                       "foleys_gui_magic [${CMAKE_CURRENT_LIST_DIR}]")
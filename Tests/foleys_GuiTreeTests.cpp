@@ -46,3 +46,20 @@ std::unique_ptr<juce::AudioProcessor> processor (new UnitTestProcessor());
 std::unique_ptr<juce::AudioProcessorEditor> editor (processor->createEditor());
 REQUIRE (editor.get() != nullptr);
 }
+
+TEST_CASE ("Binary GUI tree test", "[gui]")
+{
+juce::ValueTree tree { "magic", {}, { juce::ValueTree { "View", { { "id", "root" } } } } };
+
+juce::MemoryOutputStream stream;
+tree.writeToStream (stream);
+
+foleys::MagicGUIState magicState;
+magicState.setGuiValueTree (static_cast<const char*> (stream.getData()), int (stream.getDataSize()));
+REQUIRE (magicState.getGuiTree().isEquivalentTo (tree));
+
+auto xml = tree.toXmlString();
+foleys::MagicGUIState xmlState;
+xmlState.setGuiValueTree (xml.toRawUTF8(), int (xml.getNumBytesAsUTF8()));
+REQUIRE (xmlState.getGuiTree().isEquivalentTo (tree));
+}
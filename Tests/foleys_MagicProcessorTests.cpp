@@ -36,6 +36,7 @@
 
 #include <foleys_gui_magic/foleys_gui_magic.h>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 
 #include "foleys_TestProcessors.h"
 
@@ -45,3 +46,235 @@ TEST_CASE ("MagicProcessor test", "[processor]")
     std::unique_ptr<juce::AudioProcessorEditor> editor (processor->createEditor());
     REQUIRE (editor.get() != nullptr);
 }
+
+static void testStateRoundTrip (UnitTestProcessor& processor)
+{
+    auto* parameter = dynamic_cast<juce::RangedAudioParameter*> (processor.getParameters()[0]);
+    REQUIRE (parameter != nullptr);
+
+    parameter->setValueNotifyingHost (parameter->convertTo0to1 (42.0f));
+
+    juce::MemoryBlock state;
+    processor.getStateInformation (state);
+
+    parameter->setValueNotifyingHost (parameter->convertTo0to1 (-5.0f));
+    processor.setStateInformation (state.getData(), int (state.getSize()));
+
+    REQUIRE (parameter->convertFrom0to1 (parameter->getValue()) == Catch::Approx (42.0f).margin (0.001f));
+}
+
+TEST_CASE ("Parameter state test", "[processor]")
+{
+    UnitTestProcessor processor;
+
+    SECTION ("PARAM nodes")
+    {
+        testStateRoundTrip (processor);
+    }
+
+    SECTION ("Binary parameter block")
+    {
+        processor.getMagicState().setUseParameterBlock (true);
+        testStateRoundTrip (processor);
+    }
+
+    SECTION ("PARAM nodes after a binary parameter block")
+    {
+        auto* parameter = dynamic_cast<juce::RangedAudioParameter*> (processor.getParameters()[0]);
+        REQUIRE (parameter != nullptr);
+
+        juce::MemoryBlock state;
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (-5.0f));
+        processor.getMagicState().setUseParameterBlock (true);
+        processor.getStateInformation (state);
+
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (42.0f));
+        processor.getMagicState().setUseParameterBlock (false);
+        processor.getStateInformation (state);
+
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (10.0f));
+        processor.setStateInformation (state.getData(), int (state.getSize()));
+        REQUIRE (parameter->convertFrom0to1 (parameter->getValue()) == Catch::Approx (42.0f).margin (0.001f));
+    }
+
+    SECTION ("PARAM nodes after restoring a binary parameter block")
+    {
+        auto* parameter = dynamic_cast<juce::RangedAudioParameter*> (processor.getParameters()[0]);
+        REQUIRE (parameter != nullptr);
+
+        juce::MemoryBlock state;
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (-5.0f));
+        processor.getMagicState().setUseParameterBlock (true);
+        processor.getStateInformation (state);
+        processor.setStateInformation (state.getData(), int (state.getSize()));
+
+        processor.getMagicState().setUseParameterBlock (false);
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (42.0f));
+        processor.getStateInformation (state);
+
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (10.0f));
+        processor.setStateInformation (state.getData(), int (state.getSize()));
+        REQUIRE (parameter->convertFrom0to1 (parameter->getValue()) == Catch::Approx (42.0f).margin (0.001f));
+    }
+}
+
+TEST_CASE ("State cache test", "[processor]")
+{
+    UnitTestProcessor processor;
+    auto& magicState = processor.getMagicState();
+
+    auto* parameter = dynamic_cast<juce::RangedAudioParameter*> (processor.getParameters()[0]);
+    REQUIRE (parameter != nullptr);
+
+    juce::MemoryBlock saved, state;
+    processor.getStateInformation (saved);
+    processor.getStateInformation (state);
+    REQUIRE (state == saved);
+
+    parameter->setValueNotifyingHost (parameter->convertTo0to1 (42.0f));
+    processor.getStateInformation (state);
+    REQUIRE (state != saved);
+
+    saved = state;
+    magicState.getPropertyHandle<int> ("settings:mode").set (3);
+    processor.getStateInformation (state);
+    REQUIRE (state != saved);
+
+    saved = state;
+    magicState.getPropertyHandle<double> ("playhead:bpm").set (133.0);
+    processor.getStateInformation (state);
+    REQUIRE (state == saved);
+    REQUIRE_FALSE (magicState.getPropertyRoot().getChildWithName ("playhead").isValid());
+}
+
+struct NotificationCounter : juce::AudioProcessorParameter::Listener,
+                             juce::ValueTree::Listener
+{
+    void parameterValueChanged (int, float) override { ++parameterChanges; }
+    void parameterGestureChanged (int, bool) override {}
+    void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override { ++propertyChanges; }
+
+    int parameterChanges = 0;
+    int propertyChanges  = 0;
+};
+
+TEST_CASE ("State restore test", "[processor]")
+{
+    UnitTestProcessor processor;
+    auto& magicState = processor.getMagicState();
+
+    auto* changedParameter   = dynamic_cast<juce::RangedAudioParameter*> (processor.getParameters()[0]);
+    auto* unchangedParameter = processor.getParameters()[1];
+    REQUIRE (changedParameter != nullptr);
+
+    auto changedProperty   = magicState.getPropertyHandle<int> ("settings:mode");
+    auto unchangedProperty = magicState.getPropertyHandle<juce::String> ("other:name");
+
+    changedParameter->setValueNotifyingHost (changedParameter->convertTo0to1 (42.0f));
+    changedProperty.set (3);
+    unchangedProperty.set ("Foley");
+
+    juce::MemoryBlock state;
+    processor.getStateInformation (state);
+
+    changedParameter->setValueNotifyingHost (changedParameter->convertTo0to1 (-5.0f));
+    changedProperty.set (4);
+
+    NotificationCounter counter;
+    auto unchangedNode = magicState.getPropertyRoot().getChildWithName ("other");
+    unchangedParameter->addListener (&counter);
+    unchangedNode.addListener (&counter);
+
+    processor.setStateInformation (state.getData(), int (state.getSize()));
+
+    unchangedParameter->removeListener (&counter);
+    unchangedNode.removeListener (&counter);
+
+    REQUIRE (changedParameter->convertFrom0to1 (changedParameter->getValue()) == Catch::Approx (42.0f).margin (0.001f));
+    REQUIRE (changedProperty.get() == 3);
+    REQUIRE (unchangedProperty.get() == "Foley");
+    REQUIRE (counter.parameterChanges == 0);
+    REQUIRE (counter.propertyChanges == 0);
+}
+
+TEST_CASE ("Property handle test", "[processor]")
+{
+    UnitTestProcessor processor;
+    auto& magicState = processor.getMagicState();
+
+    auto handle = magicState.getPropertyHandle<double> ("playhead:bpm");
+    REQUIRE (handle.isValid());
+
+    REQUIRE (handle.set (120.0));
+    REQUIRE_FALSE (handle.set (120.0));
+    REQUIRE (double (magicState.getPropertyAsValue ("playhead:bpm").getValue()) == Catch::Approx (120.0));
+
+    magicState.getPropertyAsValue ("playhead:bpm").setValue (90.0);
+    REQUIRE (handle.get() == Catch::Approx (90.0));
+
+    REQUIRE_FALSE (magicState.getPropertyHandle<int> ("::").isValid());
+}
+
+TEST_CASE ("Audio to GUI channel test", "[processor]")
+{
+    UnitTestProcessor processor;
+    auto& magicState = processor.getMagicState();
+
+    auto& channel = magicState.createAudioToGuiChannel<float> ("meter:reduction");
+    REQUIRE (&channel == &magicState.createAudioToGuiChannel<float> ("meter:reduction"));
+
+    channel.publish (-6.0f);
+    REQUIRE (magicState.getPropertyHandle<float> ("meter:reduction").get() == Catch::Approx (0.0f));
+
+    magicState.getAudioToGuiChannels().dispatch();
+    REQUIRE (magicState.getPropertyHandle<float> ("meter:reduction").get() == Catch::Approx (-6.0f));
+
+    // a different type must not replace the channel the audio thread refers to
+    auto& otherChannel = magicState.createAudioToGuiChannel<int> ("meter:reduction");
+    REQUIRE (static_cast<void*> (&otherChannel) != static_cast<void*> (&channel));
+    REQUIRE (&channel == &magicState.createAudioToGuiChannel<float> ("meter:reduction"));
+
+    channel.publish (-3.0f);
+    magicState.getAudioToGuiChannels().dispatch();
+    REQUIRE (magicState.getPropertyHandle<float> ("meter:reduction").get() == Catch::Approx (-3.0f));
+
+    // the published values are not saved with the state
+    juce::MemoryBlock saved, state;
+    processor.getStateInformation (saved);
+    channel.publish (-12.0f);
+    magicState.getAudioToGuiChannels().dispatch();
+    processor.getStateInformation (state);
+    REQUIRE (state == saved);
+    REQUIRE_FALSE (magicState.getPropertyRoot().getChildWithName ("meter").isValid());
+
+    // a channel at the root of the properties is transient as well
+    auto& voices = magicState.createAudioToGuiChannel<int> ("voices");
+    processor.getStateInformation (saved);
+    voices.publish (8);
+    magicState.getAudioToGuiChannels().dispatch();
+    processor.getStateInformation (state);
+    REQUIRE (state == saved);
+    REQUIRE (magicState.getPropertyHandle<int> ("voices").get() == 8);
+    REQUIRE_FALSE (magicState.getPropertyRoot().hasProperty ("voices"));
+}
+
+TEST_CASE ("MIDI note state test", "[processor]")
+{
+    juce::MidiKeyboardState keyboardState;
+    foleys::MidiNoteState   noteState (keyboardState);
+    juce::MidiBuffer        buffer;
+
+    // notes played while nothing is injected must not be sent later
+    keyboardState.noteOn (1, 60, 0.8f);
+    noteState.processMidiBuffer (buffer, false);
+    REQUIRE (buffer.isEmpty());
+    REQUIRE (noteState.isNoteOn (1, 60));
+
+    noteState.processMidiBuffer (buffer, true);
+    REQUIRE (buffer.isEmpty());
+
+    keyboardState.noteOff (1, 60, 0.0f);
+    noteState.processMidiBuffer (buffer, true);
+    REQUIRE (buffer.getNumEvents() == 1);
+    REQUIRE_FALSE (noteState.isNoteOn (1, 60));
+}
@@ -58,6 +58,8 @@ public:
     bool acceptsMidi() const override            { return true; }
     bool producesMidi() const override           { return false; }
 
+    foleys::MagicProcessorState& getMagicState() { return magicState; }
+
 private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (UnitTestProcessor)
 };
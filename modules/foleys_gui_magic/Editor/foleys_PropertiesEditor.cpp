@@ -297,6 +297,7 @@ void PropertiesEditor::addDecoratorProperties()
     array.add (new StyleChoicePropertyComponent (builder, IDs::imagePlacement, styleItem, { IDs::imageCentred, IDs::imageFill, IDs::imageStretch }));
     array.add (new StyleTextPropertyComponent (builder, IDs::backgroundAlpha, styleItem));
     array.add (new StyleGradientPropertyComponent (builder, IDs::backgroundGradient, styleItem));
+    array.add (new StyleChoicePropertyComponent (builder, IDs::renderCache, styleItem, { IDs::renderCacheAuto, IDs::renderCacheOn, IDs::renderCacheOff }));
 
     properties.addSection ("Decorator", array, false);
 }
@@ -307,19 +308,17 @@ void PropertiesEditor::addTypeProperties (juce::Identifier type, juce::Array<juc
 
     array.addArray (additional);
 
-    juce::ValueTree node (type);
-    if (auto item = builder.createGuiItem (node))
+    const auto& metadata = builder.getFactoryMetadata (type);
+
+    for (auto p : metadata.settableProperties)
     {
-        for (auto& p : item->getSettableProperties())
-        {
-            if (auto* component = StylePropertyComponent::createComponent (builder, p, styleItem))
-                array.add (component);
-        }
+        if (auto* component = StylePropertyComponent::createComponent (builder, p, styleItem))
+            array.add (component);
+    }
 
-        for (auto colour : item->getColourNames())
-        {
-            array.add (new StyleColourPropertyComponent (builder, colour, styleItem));
-        }
+    for (auto colour : metadata.colourNames)
+    {
+        array.add (new StyleColourPropertyComponent (builder, colour, styleItem));
     }
 
     properties.addSection (type.toString(), array, false);
@@ -355,6 +354,8 @@ void PropertiesEditor::addContainerProperties()
     array.add (new StyleChoicePropertyComponent (builder, IDs::display, styleItem, { IDs::contents, IDs::flexbox, IDs::tabbed }));
     array.add (new StyleTextPropertyComponent (builder, IDs::repaintHz, styleItem));
     array.add (new StyleChoicePropertyComponent (builder, IDs::scrollMode, styleItem, { IDs::noScroll, IDs::scrollHorizontal, IDs::scrollVertical, IDs::scrollBoth }));
+    array.add (new StyleTextPropertyComponent (builder, IDs::virtualItemSize, styleItem));
+    array.add (new StyleTextPropertyComponent (builder, IDs::virtualOverscan, styleItem));
     array.add (new StyleTextPropertyComponent (builder, IDs::tabHeight, styleItem));
     array.add (new StyleChoicePropertyComponent (builder, IDs::selectedTab, styleItem, builder.createPropertiesMenuLambda()));
 
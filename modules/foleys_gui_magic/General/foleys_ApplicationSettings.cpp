@@ -35,6 +35,7 @@
 
 #include "foleys_ApplicationSettings.h"
 #include "../Helpers/foleys_ScopedInterProcessLock.h"
+#include "../Helpers/foleys_ValueTreeHelpers.h"
 
 namespace foleys
 {
@@ -46,8 +47,17 @@ ApplicationSettings::ApplicationSettings()
 
 ApplicationSettings::~ApplicationSettings()
 {
-    stopTimer();
+    watcher->removeListener (this);
     settings.removeListener (this);
+
+    if (isTimerRunning())
+    {
+        stopTimer();
+
+        // older pending writes are superseded by this one
+        writer.removeAllJobs (true, 2000);
+        flush (true);
+    }
 }
 
 void ApplicationSettings::setFileName (juce::File file)
@@ -55,12 +65,17 @@ void ApplicationSettings::setFileName (juce::File file)
     if (file == settingsFile)
         return;
 
+    watcher->removeListener (this);
     settingsFile = file;
-    startTimerHz (1);
+    watcher->addListener (settingsFile, this);
 }
 
 void ApplicationSettings::load()
 {
+    // a pending save of our own changes wins, like the last writer did before
+    if (isTimerRunning())
+        return;
+
     ScopedInterProcessLock lock (settingsFile.getFileName() + ".lock", 500,
     [this]
     {
@@ -76,8 +91,10 @@ void ApplicationSettings::load()
         if (! tree.isValid())
             return;
 
-        settings.copyPropertiesAndChildrenFrom (tree, nullptr);
-        settings.addListener (this);
+        {
+            const juce::ScopedValueSetter<bool> setter (loading, true);
+            mergeValueTree (settings, tree);
+        }
 
         checksum = newChecksum;
         sendChangeMessage();
@@ -86,28 +103,64 @@ void ApplicationSettings::load()
 
 void ApplicationSettings::save()
 {
-    ScopedInterProcessLock lock (settingsFile.getFileName() + ".lock", 1000,
-    [this] {
-        auto parent = settingsFile.getParentDirectory();
-        parent.createDirectory();
+    if (loading || settingsFile == juce::File())
+        return;
 
-        auto stream = settingsFile.createOutputStream();
-        if (stream.get() == nullptr)
+    startTimer (saveDelayMs);
+}
+
+void ApplicationSettings::flush (bool synchronous)
+{
+    const auto text = settings.toXmlString();
+    checksum = juce::MD5 (text.toUTF8()).toHexString();
+
+    if (synchronous)
+    {
+        writeSettingsFile (settingsFile, text);
+        return;
+    }
+
+    writer.addJob ([file = settingsFile, text, watcherToUpdate = watcher]
+    {
+        if (! writeSettingsFile (file, text))
             return;
 
-        stream->setPosition (0);
-        stream->truncate();
-        stream->writeString (settings.toXmlString());
+        juce::MessageManager::callAsync ([file, watcherToUpdate]
+        {
+            watcherToUpdate->updateFileState (file);
+        });
+    });
+}
+
+bool ApplicationSettings::writeSettingsFile (const juce::File& file, const juce::String& text)
+{
+    bool written = false;
+
+    ScopedInterProcessLock lock (file.getFileName() + ".lock", 1000,
+    [&]
+    {
+        file.getParentDirectory().createDirectory();
 
-        checksum = juce::MD5 (settingsFile).toHexString();
+        juce::TemporaryFile temp (file);
+        if (temp.getFile().replaceWithData (text.toRawUTF8(), text.getNumBytesAsUTF8()))
+            written = temp.overwriteTargetFileWithTemporary();
     });
+
+    return written;
 }
 
-void ApplicationSettings::timerCallback()
+void ApplicationSettings::settingsFileChanged (const juce::File&)
 {
+    // the file is only hashed and parsed, when the watcher saw a different modification time or size
     load();
 }
 
+void ApplicationSettings::timerCallback()
+{
+    stopTimer();
+    flush (false);
+}
+
 void ApplicationSettings::valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&)
 {
     save();
@@ -36,6 +36,8 @@
 #include <juce_core/juce_core.h>
 #include <juce_data_structures/juce_data_structures.h>
 
+#include "foleys_SettingsFileWatcher.h"
+
 namespace foleys
 {
 
@@ -45,8 +47,9 @@ namespace foleys
  so they don't exist duplicated in one process.
  */
 class ApplicationSettings : public juce::ChangeBroadcaster,
-                            private juce::Timer,
-                            private juce::ValueTree::Listener
+                            private SettingsFileWatcher::Listener,
+                            private juce::ValueTree::Listener,
+                            private juce::Timer
 {
 public:
     ApplicationSettings();
@@ -62,18 +65,41 @@ public:
     void setFileName (juce::File file);
 
 private:
+    void settingsFileChanged (const juce::File& file) override;
     void timerCallback() override;
 
     void load();
+
+    /**
+     Schedules saving the settings. Changes within a short time are written together.
+     */
     void save();
 
+    /**
+     Serialises the settings and writes them on the writer thread, or directly if synchronous is true.
+     */
+    void flush (bool synchronous);
+
+    /**
+     Writes the text into a temporary file and renames it, so other processes never read a partially written file.
+     */
+    static bool writeSettingsFile (const juce::File& file, const juce::String& text);
+
     void valueTreeChildAdded (juce::ValueTree& parentTree,
                               juce::ValueTree& childWhichHasBeenAdded) override;
     void valueTreeChildRemoved (juce::ValueTree& parentTree, juce::ValueTree&, int) override;
     void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override;
 
+    juce::SharedResourcePointer<SettingsFileWatcher> watcher;
+
     juce::File   settingsFile;
     juce::String checksum;
+    bool         loading = false;
+
+    static constexpr int saveDelayMs = 200;
+
+    // this needs to be the last member, so the jobs are finished before anything else is destroyed
+    juce::ThreadPool writer { 1 };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ApplicationSettings)
 };
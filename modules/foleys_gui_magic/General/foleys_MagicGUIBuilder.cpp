@@ -155,10 +155,57 @@ void MagicGUIBuilder::createGUI (juce::Component& parentToUse)
 #endif
 }
 
+void MagicGUIBuilder::detachGUI()
+{
+    closeOverlayDialog();
+
+    if (auto* container = dynamic_cast<Container*> (root.get()))
+        container->setPaused (true);
+
+    if (parent != nullptr && root.get() != nullptr)
+        parent->removeChildComponent (root.get());
+
+    parent = nullptr;
+
+#if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
+    magicToolBox.reset();
+#endif
+}
+
+void MagicGUIBuilder::attachGUI (juce::Component& parentToUse)
+{
+    // MagicGUIState::setGuiValueTree() replaces the tree without notifying the builder
+    if (root.get() == nullptr || rebuildPending || builtTree != getConfigTree())
+    {
+        createGUI (parentToUse);
+        return;
+    }
+
+    parent = &parentToUse;
+    parent->addAndMakeVisible (root.get());
+
+    if (auto* container = dynamic_cast<Container*> (root.get()))
+        container->setPaused (false);
+
+    root->setBounds (parent->getLocalBounds());
+}
+
+bool MagicGUIBuilder::hasDetachedGUI() const
+{
+    return parent == nullptr && root.get() != nullptr;
+}
+
 void MagicGUIBuilder::updateComponents()
 {
     if (parent == nullptr)
+    {
+        // a detached GUI will be recreated when it is attached again
+        rebuildPending = root.get() != nullptr;
         return;
+    }
+
+    rebuildPending = false;
+    builtTree      = getConfigTree();
 
     updateStylesheet();
 
@@ -181,7 +228,16 @@ void MagicGUIBuilder::updateLayout (juce::Rectangle<int> bounds)
         if (!stylesheet.setMediaSize (bounds.getWidth(), bounds.getHeight()))
         {
             stylesheet.updateValidRanges();
-            root->updateInternal();
+
+            const auto& changedClasses = stylesheet.getChangedMediaClasses();
+            if (! changedClasses.isEmpty())
+            {
+                juce::Array<Container*> containersToLayout;
+                updateItemsWithClasses (*root, changedClasses, containersToLayout);
+
+                for (auto* container : containersToLayout)
+                    container->updateLayout();
+            }
         }
 
         if (root->getBounds() == bounds)
@@ -201,6 +257,29 @@ void MagicGUIBuilder::updateLayout (juce::Rectangle<int> bounds)
     parent->repaint();
 }
 
+void MagicGUIBuilder::updateItemsWithClasses (GuiItem& item, const juce::StringArray& classNames, juce::Array<Container*>& containersToLayout)
+{
+    const auto itemClasses = juce::StringArray::fromTokens (item.getConfigNode().getProperty (IDs::styleClass).toString(), " ", {});
+
+    for (const auto& name : classNames)
+    {
+        if (itemClasses.contains (name))
+        {
+            // updateInternal() updates the children of a container as well
+            item.updateInternal();
+
+            if (auto* container = item.findParentComponentOfClass<Container>())
+                containersToLayout.addIfNotAlreadyThere (container);
+
+            return;
+        }
+    }
+
+    if (auto* container = dynamic_cast<Container*> (&item))
+        for (auto& child : *container)
+            updateItemsWithClasses (*child, classNames, containersToLayout);
+}
+
 void MagicGUIBuilder::updateColours()
 {
     if (root)
@@ -236,6 +315,21 @@ void MagicGUIBuilder::registerFactory (juce::Identifier type, std::unique_ptr<Gu
     factories[type] = factory;
 }
 
+void MagicGUIBuilder::registerFactory (juce::Identifier type,
+                                       std::unique_ptr<GuiItem> (*factory) (MagicGUIBuilder& builder, const juce::ValueTree&),
+                                       FactoryMetadata (*describe) (MagicGUIBuilder& builder))
+{
+    if (factories.find (type) != factories.cend())
+    {
+        // You tried to add two factories with the same type name!
+        jassertfalse;
+        return;
+    }
+
+    factories[type] = factory;
+    factoryDescriptions[type] = describe;
+}
+
 juce::StringArray MagicGUIBuilder::getFactoryNames() const
 {
     juce::StringArray names { IDs::view.toString() };
@@ -254,12 +348,7 @@ void MagicGUIBuilder::registerLookAndFeel (juce::String name, std::unique_ptr<ju
 
 void MagicGUIBuilder::registerJUCELookAndFeels()
 {
-    stylesheet.registerLookAndFeel ("LookAndFeel_V1", std::make_unique<juce::LookAndFeel_V1>());
-    stylesheet.registerLookAndFeel ("LookAndFeel_V2", std::make_unique<JuceLookAndFeel_V2>());
-    stylesheet.registerLookAndFeel ("LookAndFeel_V3", std::make_unique<JuceLookAndFeel_V3>());
-    stylesheet.registerLookAndFeel ("LookAndFeel_V4", std::make_unique<JuceLookAndFeel_V4>());
-    stylesheet.registerLookAndFeel ("FoleysFinest", std::make_unique<LookAndFeel>());
-    stylesheet.registerLookAndFeel ("Skeuomorphic", std::make_unique<Skeuomorphic>());
+    stylesheet.setUseSharedLookAndFeels (true);
 }
 
 juce::var MagicGUIBuilder::getStyleProperty (const juce::Identifier& name, const juce::ValueTree& node) const
@@ -284,11 +373,33 @@ void MagicGUIBuilder::removeStyleClassReferences (juce::ValueTree tree, const ju
 
 juce::StringArray MagicGUIBuilder::getColourNames (juce::Identifier type)
 {
-    juce::ValueTree node (type);
-    if (auto item = createGuiItem (node))
-        return item->getColourNames();
+    return getFactoryMetadata (type).colourNames;
+}
+
+const MagicGUIBuilder::FactoryMetadata& MagicGUIBuilder::getFactoryMetadata (const juce::Identifier& type)
+{
+    auto cached = factoryMetadata.find (type);
+    if (cached != factoryMetadata.end())
+        return cached->second;
 
-    return {};
+    // a Container has neither colours nor settable properties of its own
+    FactoryMetadata metadata;
+
+    if (auto description = factoryDescriptions.find (type); description != factoryDescriptions.end())
+    {
+        metadata = description->second (*this);
+    }
+    else if (auto factory = factories.find (type); factory != factories.end())
+    {
+        // the prototype is only constructed, not updated, so it doesn't attach to anything
+        if (auto prototype = factory->second (*this, juce::ValueTree (type)))
+        {
+            metadata.colourNames        = prototype->getColourNames();
+            metadata.settableProperties = prototype->getSettableProperties();
+        }
+    }
+
+    return factoryMetadata.emplace (type, std::move (metadata)).first->second;
 }
 
 std::function<void (juce::ComboBox&)> MagicGUIBuilder::createChoicesMenuLambda (juce::StringArray choices) const
@@ -46,6 +46,8 @@ namespace foleys
     class ToolBox;
 #endif
 
+class Container;
+
 /**
  The MagicGUIBuilder is responsible to recreate the GUI from a single ValueTree.
  You can add your own factories to the builder to allow additional components.
@@ -68,6 +70,23 @@ public:
      */
     void createGUI (juce::Component& parent);
 
+    /**
+     Removes the GUI from its parent without destroying it, so it can be attached to a new parent
+     using attachGUI(). The timers of the items, e.g. plots, meters and MIDI widgets, are paused meanwhile.
+     */
+    void detachGUI();
+
+    /**
+     Attaches a GUI previously removed by detachGUI() to a new parent. If there is no GUI or the
+     configuration was replaced while detached, the GUI is created instead.
+     */
+    void attachGUI (juce::Component& parent);
+
+    /**
+     Returns true, if the components were built and are currently not attached to a parent.
+     */
+    bool hasDetachedGUI() const;
+
     /**
      Grant access to the stylesheet to look up visual and layout properties
      */
@@ -128,7 +147,9 @@ public:
     void registerLookAndFeel (juce::String name, std::unique_ptr<juce::LookAndFeel> lookAndFeel);
 
     /**
-     Registers automatically the JUCE LookAndFeel classes (V1..V4 at the time of writing)
+     Makes the JUCE LookAndFeel classes (V1..V4 at the time of writing), FoleysFinest and Skeuomorphic
+     available. These are shared by all builders in the process and created when first referenced.
+     To share your own LookAndFeel, register a factory in the LookAndFeelRegistry.
      */
     void registerJUCELookAndFeels();
 
@@ -156,6 +177,30 @@ public:
      */
     juce::StringArray getColourNames (juce::Identifier type);
 
+    /**
+     The information the editor needs about a type of Component, without creating one each time.
+     */
+    struct FactoryMetadata
+    {
+        juce::StringArray             colourNames;
+        std::vector<SettableProperty> settableProperties;
+    };
+
+    /**
+     Register a factory together with the static description of its items, see FOLEYS_DECLARE_GUI_FACTORY.
+     The editor reads the colour names and settable properties from it without creating an item.
+     */
+    void registerFactory (juce::Identifier type,
+                          std::unique_ptr<GuiItem> (*factory) (MagicGUIBuilder& builder, const juce::ValueTree&),
+                          FactoryMetadata (*describe) (MagicGUIBuilder& builder));
+
+    /**
+     Returns the colour names and settable properties of a Component type. These come from the description
+     registered with the factory. Factories registered without one are asked once through an item, that is
+     created but never updated. The result is cached.
+     */
+    const FactoryMetadata& getFactoryMetadata (const juce::Identifier& type);
+
     /**
      This resets the GUI to show a single empty container
      */
@@ -244,6 +289,11 @@ public:
     void draggedItemOnto (juce::ValueTree dropped, juce::ValueTree target, int index = -1);
 
 private:
+    /**
+     Updates only the items referencing one of the classes, e.g. after a media query changed its result
+     */
+    void updateItemsWithClasses (GuiItem& item, const juce::StringArray& classNames, juce::Array<Container*>& containersToLayout);
+
     juce::UndoManager undo;
     Stylesheet        stylesheet { *this };
 
@@ -259,7 +309,14 @@ private:
 
     std::unique_ptr<juce::Component> overlayDialog;
 
+    bool rebuildPending = false;
+
+    /** The configuration the current GUI was built from */
+    juce::ValueTree builtTree;
+
     std::map<juce::Identifier, std::unique_ptr<GuiItem> (*) (MagicGUIBuilder& builder, const juce::ValueTree&)> factories;
+    std::map<juce::Identifier, FactoryMetadata (*) (MagicGUIBuilder& builder)> factoryDescriptions;
+    std::map<juce::Identifier, FactoryMetadata> factoryMetadata;
 
     juce::ListenerList<Listener> listeners;
     bool                         editMode = false;
@@ -277,6 +334,10 @@ private:
     static inline std::unique_ptr<GuiItem> factory (foleys::MagicGUIBuilder& builder, const juce::ValueTree& node)                                             \
     {                                                                                                                                                          \
         return std::make_unique<itemName> (builder, node);                                                                                                     \
+    }                                                                                                                                                          \
+    static inline foleys::MagicGUIBuilder::FactoryMetadata describe (foleys::MagicGUIBuilder& builder)                                                         \
+    {                                                                                                                                                          \
+        return { getColourNames (itemName::getColourTranslation()), itemName::describeSettableProperties (builder, {}) };                                      \
     }
 
 
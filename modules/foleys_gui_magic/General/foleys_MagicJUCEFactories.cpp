@@ -54,6 +54,22 @@ class SliderItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (SliderItem)
 
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
+    {
+        return
+        {
+            { "slider-background", juce::Slider::backgroundColourId },
+            { "slider-thumb", juce::Slider::thumbColourId },
+            { "slider-track", juce::Slider::trackColourId },
+            { "rotary-fill", juce::Slider::rotarySliderFillColourId },
+            { "rotary-outline", juce::Slider::rotarySliderOutlineColourId },
+            { "slider-text", juce::Slider::textBoxTextColourId },
+            { "slider-text-background", juce::Slider::textBoxBackgroundColourId },
+            { "slider-text-highlight", juce::Slider::textBoxHighlightColourId },
+            { "slider-text-outline", juce::Slider::textBoxOutlineColourId }
+        };
+    }
+
     static const juce::Identifier  pSliderType;
     static const juce::StringArray pSliderTypes;
 
@@ -71,18 +87,7 @@ public:
 
     SliderItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
     {
-        setColourTranslation (
-        {
-            { "slider-background", juce::Slider::backgroundColourId },
-            { "slider-thumb", juce::Slider::thumbColourId },
-            { "slider-track", juce::Slider::trackColourId },
-            { "rotary-fill", juce::Slider::rotarySliderFillColourId },
-            { "rotary-outline", juce::Slider::rotarySliderOutlineColourId },
-            { "slider-text", juce::Slider::textBoxTextColourId },
-            { "slider-text-background", juce::Slider::textBoxBackgroundColourId },
-            { "slider-text-highlight", juce::Slider::textBoxHighlightColourId },
-            { "slider-text-outline", juce::Slider::textBoxOutlineColourId }
-        });
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (slider);
     }
@@ -137,7 +142,13 @@ public:
         auto filmStripName = getProperty (pFilmStrip).toString();
         if (filmStripName.isNotEmpty())
         {
-            auto filmStrip = Resources::getImage (filmStripName);
+            // the film strip is decoded in the background, update again when it's ready
+            juce::Component::SafePointer<SliderItem> safeThis (this);
+            auto filmStrip = imageCache->getImage (filmStripName, [safeThis]
+                                                   {
+                                                       if (safeThis)
+                                                           safeThis->update();
+                                                   });
             slider.setFilmStrip (filmStrip);
         }
 
@@ -145,24 +156,29 @@ public:
         slider.setNumImages (numFilmImages, false);
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
 
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pSliderType, SettableProperty::Choice, pSliderTypes [0], magicBuilder.createChoicesMenuLambda (pSliderTypes) });
-        props.push_back ({ configNode, pSliderTextBox, SettableProperty::Choice, pTextBoxPositions [2], magicBuilder.createChoicesMenuLambda (pTextBoxPositions) });
-        props.push_back ({ configNode, pValue, SettableProperty::Choice, 1.0f, magicBuilder.createPropertiesMenuLambda() });
-        props.push_back ({ configNode, pMinValue, SettableProperty::Number, 0.0f, {} });
-        props.push_back ({ configNode, pMaxValue, SettableProperty::Number, 2.0f, {} });
-        props.push_back ({ configNode, pInterval, SettableProperty::Number, 0.0f, {} });
-        props.push_back ({ configNode, pSuffix, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, pFilmStrip, SettableProperty::Choice, 0.0f, magicBuilder.createChoicesMenuLambda(Resources::getResourceFileNames()) });
-        props.push_back ({ configNode, pNumImages, SettableProperty::Number, 0.0f, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pSliderType, SettableProperty::Choice, pSliderTypes [0], builder.createChoicesMenuLambda (pSliderTypes) });
+        props.push_back ({ node, pSliderTextBox, SettableProperty::Choice, pTextBoxPositions [2], builder.createChoicesMenuLambda (pTextBoxPositions) });
+        props.push_back ({ node, pValue, SettableProperty::Choice, 1.0f, builder.createPropertiesMenuLambda() });
+        props.push_back ({ node, pMinValue, SettableProperty::Number, 0.0f, {} });
+        props.push_back ({ node, pMaxValue, SettableProperty::Number, 2.0f, {} });
+        props.push_back ({ node, pInterval, SettableProperty::Number, 0.0f, {} });
+        props.push_back ({ node, pSuffix, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, pFilmStrip, SettableProperty::Choice, 0.0f, builder.createChoicesMenuLambda(Resources::getResourceFileNames()) });
+        props.push_back ({ node, pNumImages, SettableProperty::Number, 0.0f, {} });
 
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
     juce::String getControlledParameterID (juce::Point<int>) override
     {
         return configNode.getProperty (IDs::parameter, juce::String()).toString();
@@ -175,6 +191,7 @@ public:
 
 private:
     AutoOrientationSlider slider;
+    juce::SharedResourcePointer<ResourceImageCache> imageCache;
     std::unique_ptr<juce::SliderParameterAttachment> attachment;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SliderItem)
@@ -199,9 +216,9 @@ class ComboBoxItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (ComboBoxItem)
 
-    ComboBoxItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "combo-background", juce::ComboBox::backgroundColourId },
             { "combo-text", juce::ComboBox::textColourId },
@@ -213,7 +230,12 @@ public:
             { "combo-menu-background-highlight", juce::PopupMenu::highlightedBackgroundColourId },
             { "combo-menu-text", juce::PopupMenu::textColourId },
             { "combo-menu-text-highlight", juce::PopupMenu::highlightedTextColourId }
-        });
+        };
+    }
+
+    ComboBoxItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (comboBox);
     }
@@ -234,13 +256,18 @@ public:
         }
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &comboBox;
@@ -260,19 +287,24 @@ class TextButtonItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (TextButtonItem)
 
-    static const juce::Identifier pText;
-    static const juce::Identifier pProperty;
-    static const juce::Identifier pOnClick;
-
-    TextButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "button-color", juce::TextButton::buttonColourId },
             { "button-on-color", juce::TextButton::buttonOnColourId },
             { "button-off-text", juce::TextButton::textColourOffId },
             { "button-on-text", juce::TextButton::textColourOnId }
-        });
+        };
+    }
+
+    static const juce::Identifier pText;
+    static const juce::Identifier pProperty;
+    static const juce::Identifier pOnClick;
+
+    TextButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (button);
     }
@@ -323,20 +355,25 @@ public:
         handler.setRadioGroupValue(radioValue, getMagicState().getParameter(parameterName));
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
 
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pText, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, pProperty, SettableProperty::Choice, {}, magicBuilder.createPropertiesMenuLambda() });
-        props.push_back ({ configNode, pOnClick, SettableProperty::Choice, {}, magicBuilder.createTriggerMenuLambda() });
-        props.push_back ({ configNode, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pText, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, pProperty, SettableProperty::Choice, {}, builder.createPropertiesMenuLambda() });
+        props.push_back ({ node, pOnClick, SettableProperty::Choice, {}, builder.createTriggerMenuLambda() });
+        props.push_back ({ node, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
 
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &button;
@@ -363,17 +400,22 @@ class ToggleButtonItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (ToggleButtonItem)
 
-    static const juce::Identifier pText;
-    static const juce::Identifier pProperty;
-
-    ToggleButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "toggle-text", juce::ToggleButton::textColourId },
             { "toggle-tick", juce::ToggleButton::tickColourId },
             { "toggle-tick-disabled", juce::ToggleButton::tickDisabledColourId }
-        });
+        };
+    }
+
+    static const juce::Identifier pText;
+    static const juce::Identifier pProperty;
+
+    ToggleButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (button);
     }
@@ -405,17 +447,22 @@ public:
         handler.setRadioGroupValue(radioValue, getMagicState().getParameter(parameterName));
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, pText, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pProperty, SettableProperty::Choice, {}, magicBuilder.createPropertiesMenuLambda() });
-        props.push_back ({ configNode, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, pText, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pProperty, SettableProperty::Choice, {}, builder.createPropertiesMenuLambda() });
+        props.push_back ({ node, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &button;
@@ -439,15 +486,9 @@ class LabelItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (LabelItem)
 
-    static const juce::Identifier  pText;
-    static const juce::Identifier  pJustification;
-    static const juce::Identifier  pFontSize;
-    static const juce::Identifier  pEditable;
-    static const juce::Identifier  pValue;
-
-    LabelItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "label-background",         juce::Label::backgroundColourId },
             { "label-outline",            juce::Label::outlineColourId },
@@ -455,7 +496,18 @@ public:
             { "label-editing-background", juce::Label::backgroundWhenEditingColourId },
             { "label-editing-outline",    juce::Label::outlineWhenEditingColourId },
             { "label-editing-text",       juce::Label::textWhenEditingColourId }
-        });
+        };
+    }
+
+    static const juce::Identifier  pText;
+    static const juce::Identifier  pJustification;
+    static const juce::Identifier  pFontSize;
+    static const juce::Identifier  pEditable;
+    static const juce::Identifier  pValue;
+
+    LabelItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (label);
     }
@@ -504,18 +556,23 @@ public:
             label.getTextValue().referTo (getMagicState().getPropertyAsValue (propertyPath));
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, pText, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, pJustification, SettableProperty::Choice, {}, magicBuilder.createChoicesMenuLambda (getAllKeyNames (makeJustificationsChoices())) });
-        props.push_back ({ configNode, pFontSize, SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, pEditable, SettableProperty::Toggle, {}, {} });
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pValue, SettableProperty::Choice, {}, magicBuilder.createPropertiesMenuLambda() });
+        props.push_back ({ node, pText, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, pJustification, SettableProperty::Choice, {}, builder.createChoicesMenuLambda (getAllKeyNames (makeJustificationsChoices())) });
+        props.push_back ({ node, pFontSize, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, pEditable, SettableProperty::Toggle, {}, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pValue, SettableProperty::Choice, {}, builder.createPropertiesMenuLambda() });
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &label;
@@ -540,18 +597,23 @@ class PlotItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (PlotItem)
 
-    static const juce::Identifier  pDecay;
-    static const juce::Identifier  pGradient;
-
-    PlotItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "plot-color", MagicPlotComponent::plotColourId },
             { "plot-fill-color", MagicPlotComponent::plotFillColourId },
             { "plot-inactive-color", MagicPlotComponent::plotInactiveColourId },
             { "plot-inactive-fill-color", MagicPlotComponent::plotInactiveFillColourId }
-        });
+        };
+    }
+
+    static const juce::Identifier  pDecay;
+    static const juce::Identifier  pGradient;
+
+    PlotItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (plot);
     }
@@ -569,15 +631,22 @@ public:
         plot.setGradientFromString (gradient, magicBuilder.getStylesheet());
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, IDs::source, SettableProperty::Choice, {}, magicBuilder.createObjectsMenuLambda<MagicPlotSource>() });
-        props.push_back ({ configNode, pDecay,      SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, pGradient,   SettableProperty::Gradient, {}, {} });
+        props.push_back ({ node, IDs::source, SettableProperty::Choice, {}, builder.createObjectsMenuLambda<MagicPlotSource>() });
+        props.push_back ({ node, pDecay,      SettableProperty::Number, {}, {} });
+        props.push_back ({ node, pGradient,   SettableProperty::Gradient, {}, {} });
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
+    bool isAnimated() const override { return true; }
+
     juce::Component* getWrappedComponent() override
     {
         return &plot;
@@ -598,6 +667,19 @@ class XYDraggerItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (XYDraggerItem)
 
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
+    {
+        return
+        {
+            { "xy-drag-handle",      XYDragComponent::xyDotColourId },
+            { "xy-drag-handle-over", XYDragComponent::xyDotOverColourId },
+            { "xy-horizontal",       XYDragComponent::xyHorizontalColourId },
+            { "xy-horizontal-over",  XYDragComponent::xyHorizontalOverColourId },
+            { "xy-vertical",         XYDragComponent::xyVerticalColourId },
+            { "xy-vertical-over",    XYDragComponent::xyVerticalOverColourId }
+        };
+    }
+
     static const juce::Identifier  pCrosshair;
     static const juce::StringArray pCrosshairTypes;
     static const juce::Identifier  pRadius;
@@ -609,15 +691,7 @@ public:
     XYDraggerItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
       : GuiItem (builder, node)
     {
-        setColourTranslation (
-        {
-            { "xy-drag-handle",      XYDragComponent::xyDotColourId },
-            { "xy-drag-handle-over", XYDragComponent::xyDotOverColourId },
-            { "xy-horizontal",       XYDragComponent::xyHorizontalColourId },
-            { "xy-horizontal-over",  XYDragComponent::xyHorizontalOverColourId },
-            { "xy-vertical",         XYDragComponent::xyVerticalColourId },
-            { "xy-vertical-over",    XYDragComponent::xyVerticalOverColourId }
-        });
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (dragger);
     }
@@ -667,22 +741,27 @@ public:
             dragger.setJumpToClick (jumpToClick);
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
 
-        props.push_back ({ configNode, IDs::parameterX, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, IDs::parameterY, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pContextParameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pWheelParameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pCrosshair, SettableProperty::Choice, {}, magicBuilder.createChoicesMenuLambda (pCrosshairTypes) });
-        props.push_back ({ configNode, pRadius, SettableProperty::Number, {}, {}});
-        props.push_back ({ configNode, pSenseFactor, SettableProperty::Number, {}, {}});
-        props.push_back ({ configNode, pJumpToClick, SettableProperty::Toggle, {}, {}});
+        props.push_back ({ node, IDs::parameterX, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, IDs::parameterY, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pContextParameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pWheelParameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pCrosshair, SettableProperty::Choice, {}, builder.createChoicesMenuLambda (pCrosshairTypes) });
+        props.push_back ({ node, pRadius, SettableProperty::Number, {}, {}});
+        props.push_back ({ node, pSenseFactor, SettableProperty::Number, {}, {}});
+        props.push_back ({ node, pJumpToClick, SettableProperty::Toggle, {}, {}});
 
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &dragger;
@@ -708,22 +787,35 @@ class KeyboardItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (KeyboardItem)
 
-    KeyboardItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
-      : GuiItem (builder, node),
-        keyboard (getMagicState().getKeyboardState(), juce::MidiKeyboardComponent::horizontalKeyboard)
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "white-note-color",      juce::MidiKeyboardComponent::whiteNoteColourId },
             { "black-note-color",      juce::MidiKeyboardComponent::blackNoteColourId },
             { "key-separator-line-color", juce::MidiKeyboardComponent::keySeparatorLineColourId },
             { "mouse-over-color",      juce::MidiKeyboardComponent::mouseOverKeyOverlayColourId },
             { "key-down-color",        juce::MidiKeyboardComponent::keyDownOverlayColourId },
-        });
+        };
+    }
+
+    KeyboardItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
+      : GuiItem (builder, node),
+        keyboard (getMagicState().getKeyboardState(), juce::MidiKeyboardComponent::horizontalKeyboard)
+    {
+        setColourTranslation (getColourTranslation());
+
+        getMagicState().getNoteState().startMirroring();
 
         addAndMakeVisible (keyboard);
     }
 
+    ~KeyboardItem() override
+    {
+        if (! paused)
+            getMagicState().getNoteState().stopMirroring();
+    }
+
     void update() override
     {
         auto size = getProperty ("key-width");
@@ -738,6 +830,22 @@ public:
             keyboard.setOrientation (juce::MidiKeyboardComponent::horizontalKeyboard);
     }
 
+    bool isAnimated() const override { return true; }
+
+    void setPaused (bool shouldPause) override
+    {
+        if (paused == shouldPause)
+            return;
+
+        paused = shouldPause;
+
+        // the juce::MidiKeyboardComponent polls its state with its own timer, that can't be paused
+        if (paused)
+            getMagicState().getNoteState().stopMirroring();
+        else
+            getMagicState().getNoteState().startMirroring();
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &keyboard;
@@ -745,6 +853,7 @@ public:
 
 private:
     juce::MidiKeyboardComponent keyboard;
+    bool                        paused = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (KeyboardItem)
 };
@@ -760,11 +869,9 @@ public:
 
     FOLEYS_DECLARE_GUI_FACTORY (DrumpadItem)
 
-    DrumpadItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
-      : GuiItem (builder, node),
-        drumpad (getMagicState().getKeyboardState())
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "drumpad-background",   MidiDrumpadComponent::background },
             { "drumpad-fill",         MidiDrumpadComponent::padFill },
@@ -772,11 +879,26 @@ public:
             { "drumpad-down-fill",    MidiDrumpadComponent::padDownFill },
             { "drumpad-down-outline", MidiDrumpadComponent::padDownOutline },
             { "drumpad-touch",        MidiDrumpadComponent::touch },
-        });
+        };
+    }
+
+    DrumpadItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
+      : GuiItem (builder, node),
+        drumpad (getMagicState().getKeyboardState())
+    {
+        setColourTranslation (getColourTranslation());
+
+        getMagicState().getNoteState().startMirroring();
 
         addAndMakeVisible (drumpad);
     }
 
+    ~DrumpadItem() override
+    {
+        if (! paused)
+            getMagicState().getNoteState().stopMirroring();
+    }
+
     void update() override
     {
         auto rowsVar    = getProperty (pRows);
@@ -792,15 +914,41 @@ public:
             drumpad.setRootNote (rootNote);
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, pColumns,  SettableProperty::Number,  3, {}});
-        props.push_back ({ configNode, pRows,     SettableProperty::Number,  3, {}});
-        props.push_back ({ configNode, pRootNote, SettableProperty::Number, 64, {}});
+        props.push_back ({ node, pColumns,  SettableProperty::Number,  3, {}});
+        props.push_back ({ node, pRows,     SettableProperty::Number,  3, {}});
+        props.push_back ({ node, pRootNote, SettableProperty::Number, 64, {}});
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
+    bool isAnimated() const override { return true; }
+
+    void setPaused (bool shouldPause) override
+    {
+        if (paused == shouldPause)
+            return;
+
+        paused = shouldPause;
+
+        if (paused)
+        {
+            drumpad.stopTimer();
+            getMagicState().getNoteState().stopMirroring();
+        }
+        else
+        {
+            drumpad.startTimerHz (30);
+            getMagicState().getNoteState().startMirroring();
+        }
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &drumpad;
@@ -808,6 +956,7 @@ public:
 
 private:
     MidiDrumpadComponent drumpad;
+    bool                 paused = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DrumpadItem)
 };
@@ -822,16 +971,21 @@ class LevelMeterItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (LevelMeterItem)
 
-    LevelMeterItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> getColourTranslation()
     {
-        setColourTranslation (
+        return
         {
             { "background-color", MagicLevelMeter::backgroundColourId },
             { "bar-background-color", MagicLevelMeter::barBackgroundColourId },
             { "outline-color", MagicLevelMeter::outlineColourId },
             { "bar-fill-color", MagicLevelMeter::barFillColourId },
             { "tickmark-color", MagicLevelMeter::tickmarkColourId },
-        });
+        };
+    }
+
+    LevelMeterItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (getColourTranslation());
 
         addAndMakeVisible (meter);
     }
@@ -843,13 +997,25 @@ public:
             meter.setLevelSource (getMagicState().getObjectWithType<MagicLevelSource>(sourceID));
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, IDs::source, SettableProperty::Choice, {}, magicBuilder.createObjectsMenuLambda<MagicLevelSource>() });
+        props.push_back ({ node, IDs::source, SettableProperty::Choice, {}, builder.createObjectsMenuLambda<MagicLevelSource>() });
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
+    bool isAnimated() const override { return true; }
+
+    void setPaused (bool shouldPause) override
+    {
+        meter.setPaused (shouldPause);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &meter;
@@ -878,6 +1044,13 @@ public:
 
     void update() override {}
 
+    bool isAnimated() const override { return true; }
+
+    void setPaused (bool shouldPause) override
+    {
+        midiLearn.setPaused (shouldPause);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &midiLearn;
@@ -929,13 +1102,18 @@ public:
         }
     }
 
-    std::vector<SettableProperty> getSettableProperties() const override
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, "list-box-model", SettableProperty::Choice, {}, magicBuilder.createObjectsMenuLambda<juce::ListBoxModel>() });
+        props.push_back ({ node, "list-box-model", SettableProperty::Choice, {}, builder.createObjectsMenuLambda<juce::ListBoxModel>() });
         return props;
     }
 
+    std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return describeSettableProperties (magicBuilder, configNode);
+    }
+
     juce::Component* getWrappedComponent() override
     {
         return &listBox;
@@ -962,21 +1140,31 @@ public:
 
     WebBrowserItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
     {
-        addAndMakeVisible (browser);
     }
 
     void update() override
     {
-        browser.goToURL (getProperty ("url").toString());
+        // the native browser is created on first use, so querying the item's properties stays cheap
+        if (browser == nullptr)
+        {
+            browser = std::make_unique<juce::WebBrowserComponent>();
+            addAndMakeVisible (*browser);
+
+            // updateInternal() configured the item before the browser existed
+            configureComponent();
+            updateColours();
+        }
+
+        browser->goToURL (getProperty ("url").toString());
     }
 
     juce::Component* getWrappedComponent() override
     {
-        return &browser;
+        return browser.get();
     }
 
 private:
-    juce::WebBrowserComponent browser;
+    std::unique_ptr<juce::WebBrowserComponent> browser;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WebBrowserItem)
 };
@@ -984,21 +1172,21 @@ private:
 
 void MagicGUIBuilder::registerJUCEFactories()
 {
-    registerFactory (IDs::slider, &SliderItem::factory);
-    registerFactory (IDs::comboBox, &ComboBoxItem::factory);
-    registerFactory (IDs::textButton, &TextButtonItem::factory);
-    registerFactory (IDs::toggleButton, &ToggleButtonItem::factory);
-    registerFactory (IDs::label, &LabelItem::factory);
-    registerFactory (IDs::plot, &PlotItem::factory);
-    registerFactory (IDs::xyDragComponent, &XYDraggerItem::factory);
-    registerFactory (IDs::keyboardComponent, &KeyboardItem::factory);
-    registerFactory (IDs::drumpadComponent, &DrumpadItem::factory);
-    registerFactory (IDs::meter, &LevelMeterItem::factory);
-    registerFactory ("MidiLearn", &MidiLearnItem::factory);
-    registerFactory (IDs::listBox, &ListBoxItem::factory);
+    registerFactory (IDs::slider, &SliderItem::factory, &SliderItem::describe);
+    registerFactory (IDs::comboBox, &ComboBoxItem::factory, &ComboBoxItem::describe);
+    registerFactory (IDs::textButton, &TextButtonItem::factory, &TextButtonItem::describe);
+    registerFactory (IDs::toggleButton, &ToggleButtonItem::factory, &ToggleButtonItem::describe);
+    registerFactory (IDs::label, &LabelItem::factory, &LabelItem::describe);
+    registerFactory (IDs::plot, &PlotItem::factory, &PlotItem::describe);
+    registerFactory (IDs::xyDragComponent, &XYDraggerItem::factory, &XYDraggerItem::describe);
+    registerFactory (IDs::keyboardComponent, &KeyboardItem::factory, &KeyboardItem::describe);
+    registerFactory (IDs::drumpadComponent, &DrumpadItem::factory, &DrumpadItem::describe);
+    registerFactory (IDs::meter, &LevelMeterItem::factory, &LevelMeterItem::describe);
+    registerFactory ("MidiLearn", &MidiLearnItem::factory, &MidiLearnItem::describe);
+    registerFactory (IDs::listBox, &ListBoxItem::factory, &ListBoxItem::describe);
 
 #if JUCE_MODULE_AVAILABLE_juce_gui_extra && JUCE_WEB_BROWSER
-    registerFactory (IDs::webBrowser, &WebBrowserItem::factory);
+    registerFactory (IDs::webBrowser, &WebBrowserItem::factory, &WebBrowserItem::describe);
 #endif // JUCE_WEB_BROWSER
 }
 
@@ -41,12 +41,16 @@ namespace foleys
 MagicPluginEditor::MagicPluginEditor (MagicProcessorState& stateToUse, std::unique_ptr<MagicGUIBuilder> builderToUse)
   : juce::AudioProcessorEditor (*stateToUse.getProcessor()),
     processorState (stateToUse),
-    builder (std::move (builderToUse))
+    builder (std::move (builderToUse)),
+    vBlankAttachment (this, [this] { processorState.getAudioToGuiChannels().dispatch(); })
 {
 #if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
     oglContext.attachTo (*this);
 #endif
 
+    if (builder.get() == nullptr)
+        builder = processorState.takeKeptGUIBuilder();
+
     if (builder.get() == nullptr)
     {
         builder = std::make_unique<MagicGUIBuilder>(processorState);
@@ -55,14 +59,16 @@ MagicPluginEditor::MagicPluginEditor (MagicProcessorState& stateToUse, std::uniq
     }
 
     auto guiTree = processorState.getGuiTree();
-    if (guiTree.isValid())
+    if (builder->hasDetachedGUI())
+        builder->attachGUI (*this);
+    else if (guiTree.isValid())
         setConfigTree (guiTree);
 
     updateSize();
 
 #if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
-    if (!guiTree.isValid() && processorState.getValueTree().isValid())
-        processorState.getValueTree().addChild (builder->getConfigTree(), -1, nullptr);
+    if (!guiTree.isValid())
+        processorState.setEditedGuiTree (builder->getConfigTree());
 
     builder->attachToolboxToWindow (*this);
 #endif
@@ -73,6 +79,12 @@ MagicPluginEditor::~MagicPluginEditor()
 #if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
     oglContext.detach();
 #endif
+
+    if (processorState.getKeepEditorAlive())
+    {
+        builder->detachGUI();
+        processorState.keepGUIBuilder (std::move (builder));
+    }
 }
 
 void MagicPluginEditor::updateSize()
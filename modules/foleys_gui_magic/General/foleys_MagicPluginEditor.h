@@ -88,6 +88,9 @@ private:
 
     std::unique_ptr<MagicGUIBuilder> builder;
 
+    // copies the values published from the audio thread into the properties once per frame
+    juce::VBlankAttachment vBlankAttachment;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicPluginEditor)
 };
 
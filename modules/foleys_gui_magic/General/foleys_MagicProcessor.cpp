@@ -88,6 +88,9 @@ juce::AudioProcessorEditor* MagicProcessor::createEditor()
 {
     magicState.updateParameterMap();
 
+    if (auto keptBuilder = magicState.takeKeptGUIBuilder())
+        return new MagicPluginEditor (magicState, std::move (keptBuilder));
+
     auto builder = std::make_unique<MagicGUIBuilder>(magicState);
     initialiseBuilder (*builder);
 
@@ -0,0 +1,204 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_ResourceImageCache.h"
+#include "foleys_Resources.h"
+
+namespace foleys
+{
+
+ResourceImageCache::~ResourceImageCache()
+{
+    decoder.removeAllJobs (true, 2000);
+}
+
+bool ResourceImageCache::Key::operator< (const Key& other) const
+{
+    return std::tie (name, width, height) < std::tie (other.name, other.width, other.height);
+}
+
+juce::Image ResourceImageCache::getImage (const juce::String& name, std::function<void()> onReady)
+{
+    if (name.isEmpty())
+        return {};
+
+    const juce::ScopedLock sl (lock);
+
+    const Key key { name };
+    if (const auto* image = findImage (key))
+        return *image;
+
+    request (key, {}, std::move (onReady));
+    return {};
+}
+
+ResourceImageCache::ScaledImage ResourceImageCache::getScaledImage (const juce::String& name,
+                                                                     juce::Rectangle<float> target,
+                                                                     float scale,
+                                                                     juce::RectanglePlacement placement,
+                                                                     std::function<void()> onReady)
+{
+    if (name.isEmpty() || target.isEmpty())
+        return {};
+
+    const juce::ScopedLock sl (lock);
+
+    const auto* original = findImage (Key { name });
+    if (original == nullptr)
+    {
+        request (Key { name }, {}, std::move (onReady));
+        return {};
+    }
+
+    const auto area = placement.appliedTo (original->getBounds().toFloat(), target.withZeroOrigin());
+    const Key  key { name, juce::roundToInt (area.getWidth() * scale), juce::roundToInt (area.getHeight() * scale) };
+
+    if (key.width <= 0 || key.height <= 0 || (key.width == original->getWidth() && key.height == original->getHeight()))
+        return { *original, area };
+
+    if (const auto* image = findImage (key))
+        return { *image, area };
+
+    // draw the original until the resampled one is ready
+    request (key, *original, std::move (onReady));
+    return { *original, area };
+}
+
+void ResourceImageCache::setMaximumCacheSize (size_t numBytes)
+{
+    const juce::ScopedLock sl (lock);
+    maxCacheSize = numBytes;
+    evictImages();
+}
+
+void ResourceImageCache::clear()
+{
+    const juce::ScopedLock sl (lock);
+    images.clear();
+    failed.clear();
+    cacheSize = 0;
+}
+
+const juce::Image* ResourceImageCache::findImage (const Key& key)
+{
+    auto entry = images.find (key);
+    if (entry == images.end())
+        return nullptr;
+
+    entry->second.lastUsed = ++useCounter;
+    return &entry->second.image;
+}
+
+void ResourceImageCache::request (const Key& key, const juce::Image& source, std::function<void()> onReady)
+{
+    // a missing or corrupt resource is not decoded again on every paint
+    if (failed.find (key) != failed.end())
+        return;
+
+    auto& callbacks = pending [key];
+    const auto alreadyRequested = ! callbacks.empty();
+
+    callbacks.push_back (std::move (onReady));
+
+    if (alreadyRequested)
+        return;
+
+    decoder.addJob ([this, key, source]
+    {
+        juce::Image image;
+
+        if (key.isOriginal())
+        {
+            int dataSize = 0;
+            if (const auto* data = Resources::getResourceData (key.name, dataSize))
+                image = juce::ImageFileFormat::loadFrom (data, size_t (dataSize));
+        }
+        else if (source.isValid())
+        {
+            image = source.rescaled (key.width, key.height, juce::Graphics::highResamplingQuality);
+        }
+
+        std::vector<std::function<void()>> callbacksToCall;
+
+        {
+            const juce::ScopedLock sl (lock);
+
+            if (image.isValid())
+                addImage (key, image);
+            else
+                failed.insert (key);
+
+            callbacksToCall = std::move (pending [key]);
+            pending.erase (key);
+        }
+
+        if (image.isValid())
+        {
+            juce::MessageManager::callAsync ([callbacksToCall]
+            {
+                for (const auto& callback : callbacksToCall)
+                    if (callback)
+                        callback();
+            });
+        }
+    });
+}
+
+void ResourceImageCache::addImage (const Key& key, const juce::Image& image)
+{
+    auto& entry = images [key];
+
+    if (entry.image.isValid())
+        cacheSize -= size_t (entry.image.getWidth() * entry.image.getHeight() * 4);
+
+    entry.image    = image;
+    entry.lastUsed = ++useCounter;
+    cacheSize += size_t (image.getWidth() * image.getHeight() * 4);
+
+    evictImages();
+}
+
+void ResourceImageCache::evictImages()
+{
+    // the most recently used image always stays, otherwise we would decode in a loop
+    while (cacheSize > maxCacheSize && images.size() > 1)
+    {
+        auto oldest = std::min_element (images.begin(), images.end(), [] (const auto& a, const auto& b)
+                                        { return a.second.lastUsed < b.second.lastUsed; });
+
+        cacheSize -= size_t (oldest->second.image.getWidth() * oldest->second.image.getHeight() * 4);
+        images.erase (oldest);
+    }
+}
+
+} // namespace foleys
@@ -0,0 +1,138 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace foleys
+{
+
+/**
+ The ResourceImageCache decodes images from the BinaryData on a background thread and keeps
+ variants, that are resampled to the exact size they are drawn at. That way painting an image
+ becomes a 1:1 blit and opening an editor doesn't block on decoding PNGs.
+ The least recently used images are evicted when the cache exceeds its size.
+
+ Use it via juce::SharedResourcePointer<ResourceImageCache>, so all plugin instances share the images.
+ */
+class ResourceImageCache
+{
+public:
+    ResourceImageCache() = default;
+    ~ResourceImageCache();
+
+    struct ScaledImage
+    {
+        juce::Image            image;
+        juce::Rectangle<float> area;
+    };
+
+    /**
+     Returns the decoded image. If it wasn't decoded yet, this returns a null image and onReady is
+     called on the message thread, when the image is available.
+
+     @param name is the filename as it appears in the BinaryData (the dot is replaced as underscore)
+     @param onReady is called on the message thread if the image needs to be decoded first
+     */
+    juce::Image getImage (const juce::String& name, std::function<void()> onReady = {});
+
+    /**
+     Returns the image resampled to the size it will be drawn at, together with the area to draw it
+     in relative to the target. Until the resampled variant is ready, the full size image is returned
+     as placeholder. If the image wasn't decoded yet, the image is null.
+
+     @param name is the filename as it appears in the BinaryData
+     @param target is the area the image should be placed into
+     @param scale is the physical pixel scale of the graphics context
+     @param placement defines how the image is placed into the target
+     @param onReady is called on the message thread, when a better image is available
+     */
+    ScaledImage getScaledImage (const juce::String& name,
+                                juce::Rectangle<float> target,
+                                float scale,
+                                juce::RectanglePlacement placement,
+                                std::function<void()> onReady = {});
+
+    /**
+     Set the number of bytes the cache may hold before images are evicted. Default is 64 MB.
+     */
+    void setMaximumCacheSize (size_t numBytes);
+
+    /**
+     Remove all images, e.g. if you are low on memory. Images that failed to decode are tried again.
+     */
+    void clear();
+
+private:
+    struct Key
+    {
+        juce::String name;
+        int          width  = 0;
+        int          height = 0;
+
+        bool isOriginal() const { return width == 0 && height == 0; }
+        bool operator< (const Key& other) const;
+    };
+
+    struct Entry
+    {
+        juce::Image image;
+        juce::uint64 lastUsed = 0;
+    };
+
+    /** Needs to be called with the lock held. Returns nullptr if the image is not in the cache */
+    const juce::Image* findImage (const Key& key);
+
+    /** Needs to be called with the lock held */
+    void request (const Key& key, const juce::Image& source, std::function<void()> onReady);
+
+    void addImage (const Key& key, const juce::Image& image);
+    void evictImages();
+
+    juce::CriticalSection lock;
+
+    std::map<Key, Entry>                               images;
+    std::map<Key, std::vector<std::function<void()>>>  pending;
+    std::set<Key>                                      failed;
+    size_t                                             cacheSize    = 0;
+    size_t                                             maxCacheSize = 64 * 1024 * 1024;
+    juce::uint64                                       useCounter   = 0;
+
+    // this needs to be the last member, so the jobs are finished before anything else is destroyed
+    juce::ThreadPool decoder { 1 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResourceImageCache)
+};
+
+} // namespace foleys
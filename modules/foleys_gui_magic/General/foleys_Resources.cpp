@@ -59,11 +59,17 @@ juce::StringArray Resources::getResourceFileNames()
 juce::Image Resources::getImage (const juce::String& name)
 {
     int dataSize = 0;
-    const char* data = BinaryData::getNamedResource (name.toRawUTF8(), dataSize);
+    const char* data = getResourceData (name, dataSize);
     if (data != nullptr)
         return juce::ImageCache::getFromMemory (data, dataSize);
 
     return {};
 }
 
+const char* Resources::getResourceData (const juce::String& name, int& dataSize)
+{
+    dataSize = 0;
+    return BinaryData::getNamedResource (name.toRawUTF8(), dataSize);
+}
+
 }
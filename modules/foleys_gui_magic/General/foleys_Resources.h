@@ -53,6 +53,14 @@ namespace Resources
      */
     static inline juce::Image getImage (const juce::String& name);
 
+    /**
+     Returns the raw data of a resource from BinaryData, or nullptr if it doesn't exist
+
+     @param name is the filename as it appears in the BinaryData (the dot is replaced as underscore)
+     @param dataSize will be set to the size of the data
+     */
+    static inline const char* getResourceData (const juce::String& name, int& dataSize);
+
 }
 
 }
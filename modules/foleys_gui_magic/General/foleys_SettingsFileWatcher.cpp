@@ -0,0 +1,110 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#include "foleys_SettingsFileWatcher.h"
+
+namespace foleys
+{
+
+SettingsFileWatcher::SettingsFileWatcher()
+{
+    startTimerHz (1);
+}
+
+SettingsFileWatcher::~SettingsFileWatcher()
+{
+    stopTimer();
+}
+
+void SettingsFileWatcher::addListener (const juce::File& file, Listener* listener)
+{
+    auto& state = watchedFiles [file];
+    state.listeners.addIfNotAlreadyThere (listener);
+
+    // notify the new listener about the file that exists already
+    if (state.size >= 0)
+        listener->settingsFileChanged (file);
+}
+
+void SettingsFileWatcher::removeListener (Listener* listener)
+{
+    // the files without listeners are removed in the next timerCallback
+    for (auto& watched : watchedFiles)
+        watched.second.listeners.removeFirstMatchingValue (listener);
+}
+
+void SettingsFileWatcher::updateFileState (const juce::File& file)
+{
+    auto it = watchedFiles.find (file);
+    if (it != watchedFiles.end())
+        readFileState (file, it->second);
+}
+
+bool SettingsFileWatcher::readFileState (const juce::File& file, FileState& state)
+{
+    const auto lastModified = file.getLastModificationTime();
+    const auto size         = file.existsAsFile() ? file.getSize() : juce::int64 (-1);
+
+    if (lastModified == state.lastModified && size == state.size)
+        return false;
+
+    state.lastModified = lastModified;
+    state.size         = size;
+    return true;
+}
+
+void SettingsFileWatcher::timerCallback()
+{
+    for (auto it = watchedFiles.begin(); it != watchedFiles.end();)
+    {
+        if (it->second.listeners.isEmpty())
+            it = watchedFiles.erase (it);
+        else
+            ++it;
+    }
+
+    for (auto& watched : watchedFiles)
+    {
+        if (! readFileState (watched.first, watched.second) || watched.second.size < 0)
+            continue;
+
+        // a listener may remove itself or others while being called
+        const auto listeners = watched.second.listeners;
+        for (auto* listener : listeners)
+            if (watched.second.listeners.contains (listener))
+                listener->settingsFileChanged (watched.first);
+    }
+}
+
+} // namespace foleys
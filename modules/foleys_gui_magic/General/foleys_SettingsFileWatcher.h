@@ -0,0 +1,89 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+
+namespace foleys
+{
+
+/**
+ The SettingsFileWatcher checks files for changes using only the modification time and size.
+ It is shared per process via SharedResourcePointer, so each file is checked once per interval,
+ regardless how many instances are interested in it.
+ */
+class SettingsFileWatcher : private juce::Timer
+{
+public:
+    SettingsFileWatcher();
+    ~SettingsFileWatcher() override;
+
+    struct Listener
+    {
+        virtual ~Listener() = default;
+
+        /**
+         Called on the message thread, when the modification time or the size of the file changed.
+         */
+        virtual void settingsFileChanged (const juce::File& file) = 0;
+    };
+
+    void addListener (const juce::File& file, Listener* listener);
+    void removeListener (Listener* listener);
+
+    /**
+     Call this after writing the file yourself, so the listeners are not notified about that change.
+     */
+    void updateFileState (const juce::File& file);
+
+private:
+    void timerCallback() override;
+
+    struct FileState
+    {
+        juce::Time             lastModified;
+        juce::int64            size = -1;
+        juce::Array<Listener*> listeners;
+    };
+
+    static bool readFileState (const juce::File& file, FileState& state);
+
+    std::map<juce::File, FileState> watchedFiles;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SettingsFileWatcher)
+};
+
+} // namespace foleys
@@ -114,6 +114,8 @@ namespace IDs
     static juce::String     scrollHorizontal { "scroll-horizontal" };
     static juce::String     scrollVertical   { "scroll-vertical" };
     static juce::String     scrollBoth       { "scroll" };
+    static juce::Identifier virtualItemSize  { "virtual-item-size" };
+    static juce::Identifier virtualOverscan  { "virtual-overscan" };
 
 
     static juce::String     root         { "root" };
@@ -144,6 +146,11 @@ namespace IDs
 
     static juce::Identifier backgroundGradient  { "background-gradient" };
 
+    static juce::Identifier renderCache         { "render-cache" };
+    static juce::String     renderCacheAuto     { "auto" };
+    static juce::String     renderCacheOn       { "on" };
+    static juce::String     renderCacheOff      { "off" };
+
     static juce::Identifier flexDirection       { "flex-direction" };
     static juce::String     flexDirRow          { "row" };
     static juce::String     flexDirRowReverse   { "row-reverse" };
@@ -191,6 +198,8 @@ namespace IDs
 
     static juce::Identifier properties  { "Properties" };
     static juce::Identifier lastSize    { "last-size" };
+    static juce::Identifier guiReference { "gui-reference" };
+    static juce::Identifier guiHash      { "hash" };
 }
 
 } // namespace foleys
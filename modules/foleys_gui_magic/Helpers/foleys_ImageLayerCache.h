@@ -0,0 +1,143 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace foleys
+{
+
+/**
+ The ImageLayerCache keeps the static parts of LookAndFeel drawings as images, so components
+ with identical geometry and colours share one image instead of drawing it on every repaint.
+ The least recently used images are evicted.
+
+ Use it via juce::SharedResourcePointer<ImageLayerCache> to share it across the process.
+ */
+class ImageLayerCache
+{
+public:
+    ImageLayerCache() = default;
+
+    /**
+     Combine a value into a key for getImage().
+     */
+    template<typename ValueType>
+    static juce::uint64 addToKey (juce::uint64 key, const ValueType& value)
+    {
+        return key ^ (std::hash<ValueType>() (value) + 0x9e3779b97f4a7c15ull + (key << 6) + (key >> 2));
+    }
+
+    static juce::uint64 addToKey (juce::uint64 key, const juce::String& value)
+    {
+        return addToKey (key, juce::uint64 (value.hash()));
+    }
+
+    static juce::uint64 addToKey (juce::uint64 key, juce::Colour colour)
+    {
+        return addToKey (key, colour.getARGB());
+    }
+
+    /**
+     Returns the cached image for the key, or draws a new one.
+
+     @param key identifies everything that has an influence on the drawing, including the size
+     @param width the width in logical pixels
+     @param height the height in logical pixels
+     @param scale the physical pixel scale factor, the image will be created in physical pixels
+     @param draw the function to draw the layer in logical coordinates
+     @param verification is compared on a hit, so different content with a colliding key is redrawn, e.g. texts in the layer
+     */
+    juce::Image getImage (juce::uint64 key, int width, int height, float scale, const std::function<void (juce::Graphics&)>& draw,
+                          const juce::String& verification = {})
+    {
+        key = addToKey (addToKey (addToKey (key, width), height), scale);
+
+        const juce::ScopedLock sl (lock);
+
+        auto entry = images.find (key);
+        if (entry != images.end() && entry->second.verification == verification)
+        {
+            entry->second.lastUsed = ++useCounter;
+            return entry->second.image;
+        }
+
+        juce::Image image (juce::Image::ARGB,
+                           std::max (1, juce::roundToInt (float (width) * scale)),
+                           std::max (1, juce::roundToInt (float (height) * scale)),
+                           true);
+        {
+            juce::Graphics g (image);
+            g.addTransform (juce::AffineTransform::scale (scale));
+            draw (g);
+        }
+
+        images [key] = { image, ++useCounter, verification };
+
+        while (images.size() > maxNumImages)
+        {
+            auto oldest = std::min_element (images.begin(), images.end(), [] (const auto& a, const auto& b)
+                                            { return a.second.lastUsed < b.second.lastUsed; });
+            images.erase (oldest);
+        }
+
+        return image;
+    }
+
+    /**
+     Set the number of images to keep
+     */
+    void setMaximumNumImages (size_t numImages)
+    {
+        const juce::ScopedLock sl (lock);
+        maxNumImages = std::max (size_t (1), numImages);
+    }
+
+private:
+    struct Entry
+    {
+        juce::Image  image;
+        juce::uint64 lastUsed = 0;
+        juce::String verification;
+    };
+
+    juce::CriticalSection                  lock;
+    std::unordered_map<juce::uint64, Entry> images;
+    juce::uint64                           useCounter   = 0;
+    size_t                                 maxNumImages = 128;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ImageLayerCache)
+};
+
+} // namespace foleys
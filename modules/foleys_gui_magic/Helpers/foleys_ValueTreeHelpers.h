@@ -0,0 +1,81 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace foleys
+{
+
+/**
+ Applies only the differences of the source to the target, so listeners are only called for actual changes.
+ Children are matched by position, if the structure differs the children are replaced.
+ */
+inline void mergeValueTree (juce::ValueTree& target, const juce::ValueTree& source, juce::UndoManager* undo = nullptr)
+{
+    for (int i = target.getNumProperties() - 1; i >= 0; --i)
+    {
+        const auto name = target.getPropertyName (i);
+        if (! source.hasProperty (name))
+            target.removeProperty (name, undo);
+    }
+
+    for (int i = 0; i < source.getNumProperties(); ++i)
+    {
+        const auto name = source.getPropertyName (i);
+        target.setProperty (name, source.getProperty (name), undo);   // no notification if unchanged
+    }
+
+    auto sameStructure = target.getNumChildren() == source.getNumChildren();
+    for (int i = 0; sameStructure && i < source.getNumChildren(); ++i)
+        sameStructure = target.getChild (i).getType() == source.getChild (i).getType();
+
+    if (sameStructure)
+    {
+        for (int i = 0; i < source.getNumChildren(); ++i)
+        {
+            auto child = target.getChild (i);
+            mergeValueTree (child, source.getChild (i), undo);
+        }
+    }
+    else
+    {
+        target.removeAllChildren (undo);
+        for (const auto& child : source)
+            target.appendChild (child.createCopy(), undo);
+    }
+}
+
+} // namespace foleys
@@ -51,6 +51,7 @@ Container::~Container()
 
 void Container::update()
 {
+    invalidateLayout();
     configureFlexBox (configNode);
 
     auto focusType = magicBuilder.getStyleProperty (IDs::focusContainerType, configNode).toString();
@@ -99,28 +100,58 @@ void Container::update()
             scrollMode = ScrollMode::ScrollVertical;
         else if (scroll == IDs::scrollBoth)
             scrollMode = ScrollMode::ScrollBoth;
+    }
+
+    auto itemSize = magicBuilder.getStyleProperty (IDs::virtualItemSize, configNode).toString();
+    virtualItemSize = itemSize.isNotEmpty() ? itemSize.getIntValue() : 0;
+
+    auto overscan = magicBuilder.getStyleProperty (IDs::virtualOverscan, configNode).toString();
+    virtualOverscan = overscan.isNotEmpty() ? overscan.getIntValue() : 100;
+
+    if (virtualised != shouldVirtualise() && (! children.empty() || ! virtualNodes.empty()))
+        createSubComponents();
+    else if (virtualised)
+        updateVirtualExtents();
 
+    if (scroll.isNotEmpty() || virtualised)
         updateLayout();
-    }
 }
 
 void Container::addChildItem (std::unique_ptr<GuiItem> child)
 {
     containerBox.addAndMakeVisible (child.get());
     children.push_back (std::move (child));
+    invalidateLayout();
 }
 
 void Container::createSubComponents()
 {
     children.clear();
+    visibleItems.clear();
+    recycledItems.clear();
+    virtualNodes.clear();
+
+    virtualised = shouldVirtualise();
+    invalidateLayout();
 
-    for (auto childNode : configNode)
+    if (virtualised)
     {
-        auto childItem = magicBuilder.createGuiItem (childNode);
-        if (childItem)
+        // the GuiItems are created on demand in updateVisibleChildren()
+        for (auto childNode : configNode)
+            virtualNodes.push_back (childNode);
+
+        updateVirtualExtents();
+    }
+    else
+    {
+        for (auto childNode : configNode)
         {
-            containerBox.addAndMakeVisible (childItem.get());
-            children.push_back (std::move (childItem));
+            auto childItem = magicBuilder.createGuiItem (childNode);
+            if (childItem)
+            {
+                containerBox.addAndMakeVisible (childItem.get());
+                children.push_back (std::move (childItem));
+            }
         }
     }
 
@@ -154,6 +185,8 @@ GuiItem* Container::findGuiItem (const juce::ValueTree& node)
 
 void Container::setLayoutMode (LayoutType layoutToUse)
 {
+    invalidateLayout();
+
     layout = layoutToUse;
     if (layout == LayoutType::Tabbed)
     {
@@ -181,7 +214,7 @@ void Container::resized()
 
 void Container::updateLayout()
 {
-    if (children.empty())
+    if (children.empty() && virtualNodes.empty())
         return;
 
     viewport.setBackgroundColour (decorator.getBackgroundColour());
@@ -194,11 +227,35 @@ void Container::updateLayout()
                                  scrollMode == ScrollMode::ScrollHorizontal || scrollMode == ScrollMode::ScrollBoth);
     auto clientBounds = viewport.getLocalBounds();
 
-    if (layout == LayoutType::FlexBox)
+    // nothing that influences the children's bounds has changed since the last layout
+    if (clientBounds == lastLayoutBounds && layoutVersion == lastLayoutVersion)
+        return;
+
+    lastLayoutBounds  = clientBounds;
+    lastLayoutVersion = layoutVersion;
+
+    if (virtualised)
     {
-        flexBox.items.clear();
-        for (auto& child : children)
-            flexBox.items.add (child->getFlexItem());
+        const auto extent = virtualOffsets.empty() ? 0 : virtualOffsets.back();
+
+        // setSize() keeps the current scroll position, setBounds() would reset it
+        if (scrollMode == ScrollMode::ScrollVertical)
+            containerBox.setSize (clientBounds.getWidth() - (extent > clientBounds.getHeight() ? viewport.getScrollBarThickness() : 0), extent);
+        else
+            containerBox.setSize (extent, clientBounds.getHeight() - (extent > clientBounds.getWidth() ? viewport.getScrollBarThickness() : 0));
+
+        updateVisibleChildren();
+    }
+    else if (layout == LayoutType::FlexBox)
+    {
+        if (lastFlexItemsVersion != layoutVersion)
+        {
+            flexBox.items.clear();
+            for (auto& child : children)
+                flexBox.items.add (child->getFlexItem());
+
+            lastFlexItemsVersion = layoutVersion;
+        }
 
         auto overall = clientBounds;
         flexBox.performLayout (overall);
@@ -209,14 +266,24 @@ void Container::updateLayout()
             for (auto& child : children)
                 overall = overall.getUnion (child->getBounds());
 
+            // a second pass is only needed, if the content doesn't fit or a scrollbar takes away space
+            auto needsSecondPass = overall != clientBounds;
+
             containerBox.setBounds (overall);
 
             if (scrollMode == ScrollMode::ScrollHorizontal && viewport.isHorizontalScrollBarShown())
+            {
                 overall.removeFromBottom (viewport.getScrollBarThickness());
+                needsSecondPass = true;
+            }
             else if (scrollMode == ScrollMode::ScrollVertical && viewport.isVerticalScrollBarShown())
+            {
                 overall.removeFromRight (viewport.getScrollBarThickness());
+                needsSecondPass = true;
+            }
 
-            flexBox.performLayout (overall);
+            if (needsSecondPass)
+                flexBox.performLayout (overall);
         }
 
         containerBox.setBounds (overall);
@@ -241,9 +308,15 @@ void Container::updateLayout()
     }
 }
 
+void Container::invalidateLayout()
+{
+    ++layoutVersion;
+}
+
 void Container::updateColours()
 {
     decorator.updateColours (magicBuilder, configNode);
+    updateRenderCache();
 
     for (auto& child : children)
         child->updateColours();
@@ -254,12 +327,36 @@ void Container::updateContinuousRedraw()
     stopTimer();
     plotComponents.clear();
 
+    const auto wasAnimated = animated;
+    animated = false;
+
     for (auto& child : children)
+    {
         if (auto* p = dynamic_cast<MagicPlotComponent*>(child->getWrappedComponent()))
             plotComponents.push_back (p);
 
-    if (! plotComponents.empty())
+        animated = animated || child->isAnimated();
+    }
+
+    if (! plotComponents.empty() && ! paused)
         startTimerHz (refreshRateHz);
+
+    // the children decide, if the container can be buffered automatically
+    updateRenderCache();
+
+    if (animated != wasAnimated)
+        if (auto* parent = findParentComponentOfClass<Container>())
+            parent->updateContinuousRedraw();
+}
+
+void Container::setPaused (bool shouldPause)
+{
+    paused = shouldPause;
+
+    for (auto& child : children)
+        child->setPaused (shouldPause);
+
+    updateContinuousRedraw();
 }
 
 void Container::updateTabbedButtons()
@@ -337,6 +434,132 @@ void Container::configureFlexBox (const juce::ValueTree& node)
         flexBox.justifyContent = juce::FlexBox::JustifyContent::flexStart;
 }
 
+bool Container::isVirtualised() const
+{
+    return virtualised;
+}
+
+bool Container::shouldVirtualise() const
+{
+    return virtualItemSize > 0
+           && layout == LayoutType::FlexBox
+           && (scrollMode == ScrollMode::ScrollVertical || scrollMode == ScrollMode::ScrollHorizontal);
+}
+
+void Container::updateVirtualExtents()
+{
+    const auto& sizeProperty = scrollMode == ScrollMode::ScrollHorizontal ? IDs::width : IDs::height;
+
+    invalidateLayout();
+
+    virtualOffsets.resize (virtualNodes.size() + 1);
+    virtualOffsets [0] = 0;
+
+    for (size_t i = 0; i < virtualNodes.size(); ++i)
+    {
+        auto size = magicBuilder.getStyleProperty (sizeProperty, virtualNodes [i]);
+        virtualOffsets [i + 1] = virtualOffsets [i] + std::max (size.isVoid() ? virtualItemSize : int (size), 0);
+    }
+}
+
+void Container::updateVisibleChildren()
+{
+    if (! virtualised || virtualOffsets.size() != virtualNodes.size() + 1)
+        return;
+
+    const auto vertical = scrollMode == ScrollMode::ScrollVertical;
+    const auto area     = viewport.getViewArea();
+    const auto start    = (vertical ? area.getY() : area.getX()) - virtualOverscan;
+    const auto end      = (vertical ? area.getBottom() : area.getRight()) + virtualOverscan;
+
+    const auto numNodes = int (virtualNodes.size());
+    const auto first    = juce::jlimit (0, numNodes, int (std::upper_bound (virtualOffsets.begin(), virtualOffsets.end(), start) - virtualOffsets.begin()) - 1);
+    const auto last     = juce::jlimit (first, numNodes, int (std::lower_bound (virtualOffsets.begin(), virtualOffsets.end(), end) - virtualOffsets.begin()));
+
+    auto changed = false;
+
+    for (auto it = visibleItems.begin(); it != visibleItems.end();)
+    {
+        if (it->first < first || it->first >= last)
+        {
+            releaseItem (it->second);
+            it = visibleItems.erase (it);
+            changed = true;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (int i = first; i < last; ++i)
+    {
+        auto* item = visibleItems [i];
+        if (item == nullptr)
+        {
+            item = materialiseItem (virtualNodes [size_t (i)]);
+            if (item == nullptr)
+            {
+                visibleItems.erase (i);
+                continue;
+            }
+
+            visibleItems [i] = item;
+            changed = true;
+        }
+
+        const auto offset = virtualOffsets [size_t (i)];
+        const auto size   = virtualOffsets [size_t (i + 1)] - offset;
+
+        if (vertical)
+            item->setBounds (0, offset, containerBox.getWidth(), size);
+        else
+            item->setBounds (offset, 0, size, containerBox.getHeight());
+    }
+
+    if (changed)
+        updateContinuousRedraw();
+}
+
+GuiItem* Container::materialiseItem (const juce::ValueTree& node)
+{
+    std::unique_ptr<GuiItem> item;
+
+    auto& recycled = recycledItems [node.getType()];
+    if (! recycled.empty())
+    {
+        item = std::move (recycled.back());
+        recycled.pop_back();
+        item->setConfigNode (node);
+    }
+    else
+    {
+        item = magicBuilder.createGuiItem (node);
+    }
+
+    if (item == nullptr)
+        return nullptr;
+
+    containerBox.addAndMakeVisible (item.get());
+    children.push_back (std::move (item));
+    return children.back().get();
+}
+
+void Container::releaseItem (GuiItem* item)
+{
+    auto it = std::find_if (children.begin(), children.end(), [item] (const auto& child) { return child.get() == item; });
+    if (it == children.end())
+        return;
+
+    auto released = std::move (*it);
+    children.erase (it);
+    containerBox.removeChildComponent (released.get());
+
+    // containers would need to rebuild their whole subtree anyway, so only leaf items are kept for reuse
+    if (! released->isContainer())
+        recycledItems [released->getConfigNode().getType()].push_back (std::move (released));
+}
+
 void Container::timerCallback()
 {
     auto needsRepaint = false;
@@ -401,4 +624,9 @@ void Container::Scroller::setBackgroundColour (juce::Colour colour)
     setOpaque (backgroundColour.isOpaque());
 }
 
+void Container::Scroller::visibleAreaChanged (const juce::Rectangle<int>&)
+{
+    owner.updateVisibleChildren();
+}
+
 } // namespace foleys
@@ -101,6 +101,11 @@ public:
 
     bool isContainer() const override { return true; }
 
+    /**
+     Returns true, if any descendent is animated. This is updated bottom-up in updateContinuousRedraw().
+     */
+    bool isAnimated() const override { return animated; }
+
     void createSubComponents() override;
 
     /**
@@ -108,10 +113,22 @@ public:
      */
     void updateLayout() override;
 
+    /**
+     Marks the last layout as outdated. The next updateLayout() will then position the children,
+     even if the bounds didn't change. This is called when a child changed its flex or position settings.
+     */
+    void invalidateLayout();
+
     void updateColours() override;
 
     void updateContinuousRedraw();
 
+    /**
+     Stops the continuous redraw of this container and the timers of all descendents, e.g. while
+     the GUI is detached from the editor.
+     */
+    void setPaused (bool shouldPause) override;
+
     void configureFlexBox (const juce::ValueTree& node);
 
     juce::Component* getWrappedComponent() override { return nullptr; }
@@ -134,6 +151,14 @@ public:
      */
     void setEditMode (bool shouldEdit) override;
 
+    /**
+     Returns true, if the container only creates the children that are visible in the scrolled area.
+     This is switched on by setting virtual-item-size in a flexbox container, that scrolls either
+     vertically or horizontally. The extent of each child is taken from its width or height property
+     and falls back to the virtual-item-size. Children, that are not visible, are not found by findGuiItem().
+     */
+    bool isVirtualised() const;
+
 private:
     class Scroller : public juce::Viewport
     {
@@ -142,6 +167,7 @@ private:
 
         void paint (juce::Graphics& g) override;
         void setBackgroundColour (juce::Colour colour);
+        void visibleAreaChanged (const juce::Rectangle<int>& newVisibleArea) override;
 
     private:
         Container& owner;
@@ -156,13 +182,35 @@ private:
     void updateTabbedButtons();
     void updateSelectedTab();
 
+    bool shouldVirtualise() const;
+    void updateVirtualExtents();
+    void updateVisibleChildren();
+    GuiItem* materialiseItem (const juce::ValueTree& node);
+    void releaseItem (GuiItem* item);
+
     juce::Value   currentTab { juce::var {0} };
     int           tabbarHeight  = 30;
     int           refreshRateHz = 30;
+    bool          paused        = false;
+    bool          animated      = false;
     LayoutType    layout = LayoutType::FlexBox;
     juce::FlexBox flexBox;
     ScrollMode    scrollMode = ScrollMode::NoScroll;
 
+    int                  layoutVersion         = 0;
+    int                  lastLayoutVersion     = -1;
+    int                  lastFlexItemsVersion  = -1;
+    juce::Rectangle<int> lastLayoutBounds;
+
+    bool          virtualised     = false;
+    int           virtualItemSize = 0;
+    int           virtualOverscan = 100;
+
+    std::vector<juce::ValueTree> virtualNodes;
+    std::vector<int>             virtualOffsets;
+    std::map<int, GuiItem*>      visibleItems;
+    std::map<juce::Identifier, std::vector<std::unique_ptr<GuiItem>>> recycledItems;
+
     juce::Component                         containerBox;
     Scroller                                viewport { *this };
     std::unique_ptr<juce::TabbedButtonBar>  tabbedButtons;
@@ -36,7 +36,43 @@
 namespace foleys
 {
 
+Decorator::Decorator (juce::Component& ownerToUse)
+  : owner (&ownerToUse)
+{
+}
+
 void Decorator::drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds)
+{
+    if (! shouldCacheLayer() || bounds.isEmpty())
+    {
+        layerImage = juce::Image();
+        drawLayer (g, bounds);
+        return;
+    }
+
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    // the layer is cached by size only, the Scroller draws it with an offset
+    if (layerDirty || layerImage.isNull() || layerBounds.getWidth() != bounds.getWidth() || layerBounds.getHeight() != bounds.getHeight() || layerScale != scale)
+    {
+        layerBounds = bounds.withZeroOrigin();
+        layerScale  = scale;
+        layerDirty  = false;
+
+        layerImage = juce::Image (juce::Image::ARGB,
+                                  std::max (1, juce::roundToInt (bounds.getWidth() * scale)),
+                                  std::max (1, juce::roundToInt (bounds.getHeight() * scale)),
+                                  true);
+
+        juce::Graphics layer (layerImage);
+        layer.addTransform (juce::AffineTransform::scale (scale));
+        drawLayer (layer, layerBounds);
+    }
+
+    g.drawImage (layerImage, bounds.toFloat());
+}
+
+void Decorator::drawLayer (juce::Graphics& g, juce::Rectangle<int> bounds)
 {
     juce::Graphics::ScopedSaveState stateSave (g);
 
@@ -62,11 +98,26 @@ void Decorator::drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds)
         }
     }
 
-    if (! backgroundImage.isNull())
+    if (backgroundImage.isNotEmpty())
     {
-        juce::Graphics::ScopedSaveState save (g);
-        g.setOpacity (backgroundAlpha);
-        g.drawImage (backgroundImage, boundsf, backgroundPlacement);
+        const auto scale  = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const auto scaled = imageCache->getScaledImage (backgroundImage, boundsf, scale, backgroundPlacement,
+                                                        [this, safeOwner = owner]
+                                                        {
+                                                            // the decorator lives as long as its owner
+                                                            if (safeOwner)
+                                                            {
+                                                                layerDirty = true;
+                                                                safeOwner->repaint();
+                                                            }
+                                                        });
+
+        if (scaled.image.isValid())
+        {
+            juce::Graphics::ScopedSaveState save (g);
+            g.setOpacity (backgroundAlpha);
+            g.drawImage (scaled.image, scaled.area.translated (boundsf.getX(), boundsf.getY()));
+        }
     }
 
     if (border > 0.0f)
@@ -90,6 +141,11 @@ void Decorator::drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds)
     }
 }
 
+bool Decorator::shouldCacheLayer() const
+{
+    return caption.isNotEmpty() || backgroundImage.isNotEmpty() || ! backgroundGradient.isEmpty();
+}
+
 juce::String Decorator::getTabCaption (const juce::String& defaultName) const
 {
     return tabCaption.isNotEmpty() ? tabCaption
@@ -107,9 +163,16 @@ juce::Colour Decorator::getBackgroundColour() const
     return backgroundColour;
 }
 
+bool Decorator::isOpaque() const
+{
+    // without radius the background fills the margin too, gradients can be transparent anywhere
+    return backgroundColour.isOpaque() && backgroundGradient.isEmpty() && radius <= 0.0f;
+}
+
 void Decorator::updateColours (MagicGUIBuilder& builder, const juce::ValueTree& node)
 {
     auto& stylesheet = builder.getStylesheet();
+    layerDirty = true;
 
     auto bg = builder.getStyleProperty (IDs::backgroundColour, node);
     if (! bg.isVoid())
@@ -137,16 +200,10 @@ Decorator::ClientBounds Decorator::getClientBounds (juce::Rectangle<int> overall
             captionBox = box.removeFromTop (captionSize).toNearestInt();
         else if (justification.getOnlyVerticalFlags() & juce::Justification::bottom)
             captionBox = box.removeFromBottom (captionSize).toNearestInt();
-        else
-        {
-            juce::Font f (juce::FontOptions().withHeight (captionSize * 0.8f));
-            auto       w = float (f.getStringWidth (caption));
-
-            if (justification.getOnlyHorizontalFlags() & juce::Justification::left)
-                captionBox = box.removeFromLeft (w).toNearestInt();
-            else if (justification.getOnlyHorizontalFlags() & juce::Justification::right)
-                captionBox = box.removeFromRight (w).toNearestInt();
-        }
+        else if (justification.getOnlyHorizontalFlags() & juce::Justification::left)
+            captionBox = box.removeFromLeft (captionWidth).toNearestInt();
+        else if (justification.getOnlyHorizontalFlags() & juce::Justification::right)
+            captionBox = box.removeFromRight (captionWidth).toNearestInt();
     }
 
     return { box.toNearestInt(), captionBox };
@@ -155,6 +212,7 @@ Decorator::ClientBounds Decorator::getClientBounds (juce::Rectangle<int> overall
 void Decorator::configure (MagicGUIBuilder& builder, const juce::ValueTree& node)
 {
     auto& stylesheet = builder.getStylesheet();
+    layerDirty = true;
 
     auto borderVar = builder.getStyleProperty (IDs::border, node);
     if (! borderVar.isVoid())
@@ -188,7 +246,15 @@ void Decorator::configure (MagicGUIBuilder& builder, const juce::ValueTree& node
     else
         justification = juce::Justification::centredTop;
 
-    backgroundImage = stylesheet.getBackgroundImage (node);
+    // measured once here instead of in every layout
+    captionWidth = 0.0f;
+    if (caption.isNotEmpty())
+    {
+        juce::Font f (juce::FontOptions().withHeight (captionSize * 0.8f));
+        captionWidth = float (f.getStringWidth (caption));
+    }
+
+    backgroundImage = builder.getStyleProperty (IDs::backgroundImage, node).toString();
     backgroundGradient.setup (builder.getStyleProperty (IDs::backgroundGradient, node).toString(), stylesheet);
 
     auto alphaVar = builder.getStyleProperty (IDs::backgroundAlpha, node);
@@ -222,13 +288,18 @@ void Decorator::reset()
     captionSize   = 20.0f;
     captionColour = juce::Colours::silver;
 
+    captionWidth  = 0.0f;
+
     tabCaption.clear();
     tabColour = juce::Colours::darkgrey;
 
-    backgroundImage = juce::Image();
+    backgroundImage.clear();
     backgroundAlpha = 1.0f;
     backgroundPlacement = juce::RectanglePlacement::centred;
     backgroundGradient.clear();
+
+    layerImage = juce::Image();
+    layerDirty = true;
 }
 
 }
@@ -33,6 +33,7 @@
 
 #include "foleys_BoxModel.h"
 #include "foleys_GradientBackground.h"
+#include "../General/foleys_ResourceImageCache.h"
 
 namespace foleys
 {
@@ -45,6 +46,11 @@ public:
 
     Decorator() = default;
 
+    /**
+     @param owner is repainted, when a background image finished loading
+     */
+    explicit Decorator (juce::Component& owner);
+
     /**
      This will get the necessary information from the stylesheet, using inheritance
      of nodes if needed, to set the margins/borders etc. for the GuiItem.
@@ -70,8 +76,23 @@ public:
 
     juce::Colour getBackgroundColour() const;
 
+    /**
+     Returns true, if the decorator fills its whole bounds with an opaque colour, so nothing behind needs to be drawn.
+     */
+    bool isOpaque() const;
+
 private:
 
+    /**
+     Draws background, border and caption. This is what is cached in the layer image.
+     */
+    void drawLayer (juce::Graphics& g, juce::Rectangle<int> bounds);
+
+    /**
+     Only decorators with gradients, images or captions are cached, a plain fill is faster than a blit.
+     */
+    bool shouldCacheLayer() const;
+
     juce::Colour backgroundColour { juce::Colours::darkgrey };
     juce::Colour borderColour     { juce::Colours::silver };
 
@@ -83,16 +104,25 @@ private:
     juce::String        caption;
     juce::Justification justification = juce::Justification::centredTop;
     float               captionSize   = 20.0f;
+    float               captionWidth  = 0.0f;
     juce::Colour        captionColour = juce::Colours::silver;
 
     juce::String        tabCaption;
     juce::Colour        tabColour;
 
-    juce::Image                 backgroundImage;
+    juce::Component::SafePointer<juce::Component> owner;
+
+    juce::SharedResourcePointer<ResourceImageCache> imageCache;
+    juce::String                backgroundImage;
     float                       backgroundAlpha = 1.0f;
     juce::RectanglePlacement    backgroundPlacement = juce::RectanglePlacement::centred;
     GradientBackground          backgroundGradient;
 
+    juce::Image                 layerImage;
+    juce::Rectangle<int>        layerBounds;
+    float                       layerScale = 0.0f;
+    bool                        layerDirty = true;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Decorator)
 };
 
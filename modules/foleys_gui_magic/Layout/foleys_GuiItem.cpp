@@ -45,12 +45,12 @@ GuiItem::GuiItem (MagicGUIBuilder& builder, juce::ValueTree node)
 
     visibility.addListener (this);
     configNode.addListener (this);
-    magicBuilder.getStylesheet().addListener (this);
+    magicBuilder.getStylesheet().registerItem (this);
 }
 
 GuiItem::~GuiItem()
 {
-    magicBuilder.getStylesheet().removeListener (this);
+    magicBuilder.getStylesheet().unregisterItem (this);
 }
 
 void GuiItem::setColourTranslation (std::vector<std::pair<juce::String, int>> mapping)
@@ -59,10 +59,15 @@ void GuiItem::setColourTranslation (std::vector<std::pair<juce::String, int>> ma
 }
 
 juce::StringArray GuiItem::getColourNames() const
+{
+    return getColourNames (colourTranslation);
+}
+
+juce::StringArray GuiItem::getColourNames (const std::vector<std::pair<juce::String, int>>& translation)
 {
     juce::StringArray names;
 
-    for (const auto& pair : colourTranslation)
+    for (const auto& pair : translation)
         names.addIfNotAlreadyThere (pair.first);
 
     return names;
@@ -98,6 +103,9 @@ void GuiItem::updateInternal()
     configureFlexBoxItem (configNode);
     configurePosition (configNode);
 
+    if (auto* container = findParentComponentOfClass<Container>())
+        container->invalidateLayout();
+
     updateColours();
 
     update();
@@ -110,9 +118,29 @@ void GuiItem::updateInternal()
     repaint();
 }
 
+void GuiItem::setConfigNode (const juce::ValueTree& node)
+{
+    // a GuiItem can only be reused for a node of the type it was created for
+    jassert (node.getType() == configNode.getType());
+
+    if (node != configNode)
+    {
+        configNode.removeListener (this);
+        configNode = node;
+        configNode.addListener (this);
+        magicBuilder.getStylesheet().registerItem (this);
+
+        // the new node might not refer to a visibility property
+        visibility.referTo (juce::Value (true));
+    }
+
+    updateInternal();
+}
+
 void GuiItem::updateColours()
 {
     decorator.updateColours (magicBuilder, configNode);
+    updateRenderCache();
 
     auto* component = getWrappedComponent();
     if (component == nullptr)
@@ -126,6 +154,18 @@ void GuiItem::updateColours()
     }
 }
 
+void GuiItem::updateRenderCache()
+{
+    setOpaque (decorator.isOpaque());
+
+    const auto mode = magicBuilder.getStyleProperty (IDs::renderCache, configNode).toString();
+    const auto buffered = mode == IDs::renderCacheOn || (mode == IDs::renderCacheAuto && isContainer() && ! isAnimated());
+
+    // the buffer is invalidated by repaint() of the item or any child
+    if (buffered != (getCachedComponentImage() != nullptr))
+        setBufferedToImage (buffered);
+}
+
 void GuiItem::configureComponent()
 {
     auto* component = getWrappedComponent();
@@ -291,25 +331,17 @@ void GuiItem::valueChanged (juce::Value& source)
         setVisible (visibility.getValue());
 }
 
-void GuiItem::valueTreePropertyChanged (juce::ValueTree& treeThatChanged, const juce::Identifier&)
+void GuiItem::valueTreePropertyChanged (juce::ValueTree& treeThatChanged, const juce::Identifier& property)
 {
-    if (treeThatChanged == configNode)
+    if (treeThatChanged == configNode && ! savingPosition)
     {
+        if (property == IDs::id || property == IDs::styleClass)
+            magicBuilder.getStylesheet().registerItem (this);
+
         if (auto* parent = findParentComponentOfClass<GuiItem>())
             parent->updateInternal();
         else
             updateInternal();
-
-        return;
-    }
-
-    auto& stylesheet = magicBuilder.getStylesheet();
-    if (stylesheet.isClassNode (treeThatChanged))
-    {
-        auto name = treeThatChanged.getType().toString();
-        auto classes = configNode.getProperty (IDs::styleClass, juce::String()).toString();
-        if (classes.contains (name))
-            updateInternal();
     }
 }
 
@@ -403,14 +435,11 @@ void GuiItem::setDraggable (bool selected)
         borderDragger = std::make_unique<BorderDragger>(this, nullptr);
         componentDragger = std::make_unique<juce::ComponentDragger>();
 
+        // while dragging the component is only moved, the position is written once when released
         borderDragger->onDragStart = [&]
         {
             magicBuilder.getUndoManager().beginNewTransaction ("Drag component position");
         };
-        borderDragger->onDragging = [&]
-        {
-            savePosition();
-        };
         borderDragger->onDragEnd = [&]
         {
             savePosition();
@@ -441,10 +470,20 @@ void GuiItem::savePosition ()
     auto ph = posHeight.absolute ? juce::String (getHeight()) : juce::String (100.0 * getHeight() / parent.getHeight()) + "%";
 
     auto* undo = &magicBuilder.getUndoManager();
-    configNode.setProperty (IDs::posX, px, undo);
-    configNode.setProperty (IDs::posY, py, undo);
-    configNode.setProperty (IDs::posWidth, pw, undo);
-    configNode.setProperty (IDs::posHeight, ph, undo);
+
+    {
+        // the four properties are applied in one go below
+        const juce::ScopedValueSetter<bool> saving (savingPosition, true);
+        configNode.setProperty (IDs::posX, px, undo);
+        configNode.setProperty (IDs::posY, py, undo);
+        configNode.setProperty (IDs::posWidth, pw, undo);
+        configNode.setProperty (IDs::posHeight, ph, undo);
+    }
+
+    if (auto* parent = findParentComponentOfClass<GuiItem>())
+        parent->updateInternal();
+    else
+        updateInternal();
 }
 
 void GuiItem::mouseDown (const juce::MouseEvent& event)
@@ -461,7 +500,6 @@ void GuiItem::mouseDrag (const juce::MouseEvent& event)
     if (componentDragger)
     {
         componentDragger->dragComponent (this, event, nullptr);
-        savePosition();
     }
     else if (event.mouseWasDraggedSinceMouseDown())
     {
@@ -474,6 +512,8 @@ void GuiItem::mouseUp (const juce::MouseEvent& event)
 {
     if (! event.mouseWasDraggedSinceMouseDown())
         magicBuilder.setSelectedNode (configNode);
+    else if (componentDragger)
+        savePosition();
 }
 
 bool GuiItem::isInterestedInDragSource (const juce::DragAndDropTarget::SourceDetails &)
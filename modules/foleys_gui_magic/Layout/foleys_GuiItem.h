@@ -82,6 +82,13 @@ public:
      */
     virtual std::vector<SettableProperty> getSettableProperties() const { return {}; }
 
+    /**
+     Items declared with FOLEYS_DECLARE_GUI_FACTORY can hide these static versions with their own, so the
+     editor can read the colours and settable properties of a type without creating an item.
+     */
+    static std::vector<std::pair<juce::String, int>> getColourTranslation() { return {}; }
+    static std::vector<SettableProperty> describeSettableProperties (MagicGUIBuilder&, const juce::ValueTree&) { return {}; }
+
     /**
      For each factory you can register a translation table, which will forward the colours from the
      Stylesheet to the Components.
@@ -92,6 +99,7 @@ public:
      Return the names of configurable colours
      */
     juce::StringArray getColourNames() const;
+    static juce::StringArray getColourNames (const std::vector<std::pair<juce::String, int>>& translation);
 
     /**
      Returns the parameterID that is controlled from this component.
@@ -118,11 +126,33 @@ public:
      */
     void updateInternal();
 
+    /**
+     Returns the node in the GUI tree this item was created from.
+     */
+    const juce::ValueTree& getConfigNode() const { return configNode; }
+
+    /**
+     Let this item represent a different node of the same type and reread all properties.
+     This allows a Container to recycle GuiItems instead of creating new ones.
+     */
+    void setConfigNode (const juce::ValueTree& node);
+
     void paint (juce::Graphics& g) final;
     void resized() override;
 
     virtual bool isContainer() const { return false; }
 
+    /**
+     Return true, if the item repaints continuously, e.g. driven by a timer. Containers holding
+     such an item are not buffered by the render-cache mode "auto".
+     */
+    virtual bool isAnimated() const { return false; }
+
+    /**
+     Stops the timers driving this item, e.g. while the GUI is detached from the editor.
+     */
+    virtual void setPaused (bool shouldPause) { juce::ignoreUnused (shouldPause); }
+
     virtual void createSubComponents() {}
 
     /**
@@ -186,9 +216,23 @@ public:
 
 protected:
 
+    /**
+     Makes the item opaque, if the decorator covers it completely, and buffers it to an image
+     according to the render-cache property: "on", "off" (default) or "auto", which buffers
+     containers unless they hold an animated item. Widgets are not buffered in "auto".
+     */
+    void updateRenderCache();
+
+    /**
+     This will get the necessary information from the stylesheet, using inheritance
+     of nodes if needed, to set specific properties for the wrapped component.
+     Call this, if you create the wrapped component later than in the constructor.
+     */
+    void configureComponent();
+
     juce::ValueTree configNode;
 
-    Decorator       decorator;
+    Decorator       decorator { *this };
 
     juce::FlexItem  flexItem { juce::FlexItem (*this).withFlex (1.0f) };
 
@@ -238,12 +282,6 @@ private:
 
     void valueTreeParentChanged (juce::ValueTree&) override;
 
-    /**
-     This will get the necessary information from the stylesheet, using inheritance
-     of nodes if needed, to set specific properties for the wrapped component.
-     */
-    void configureComponent();
-
     juce::Value     visibility { true };
 
     juce::String    highlight;
@@ -254,6 +292,7 @@ private:
         double value = 0.0;
     };
     Position posX, posY, posWidth, posHeight;
+    bool     savingPosition = false;
 
     void configurePosition (const juce::var& v, Position& p, double d);
     void savePosition ();
@@ -44,15 +44,16 @@ RootItem::RootItem (MagicGUIBuilder& builder, juce::ValueTree node)
 
 void RootItem::updateColours()
 {
+    // the LookAndFeels are shared with other editors, so the colours are set on the TooltipWindow only
     auto text = magicBuilder.getStyleProperty (IDs::tooltipText, configNode);
     if (! text.isVoid())
-        tooltip.getLookAndFeel().setColour (juce::TooltipWindow::textColourId, Stylesheet::parseColour (text));
+        tooltip.setColour (juce::TooltipWindow::textColourId, Stylesheet::parseColour (text));
     auto background = magicBuilder.getStyleProperty (IDs::tooltipBackground, configNode);
     if (! background.isVoid())
-        tooltip.getLookAndFeel().setColour (juce::TooltipWindow::backgroundColourId, Stylesheet::parseColour (background));
+        tooltip.setColour (juce::TooltipWindow::backgroundColourId, Stylesheet::parseColour (background));
     auto outline = magicBuilder.getStyleProperty (IDs::tooltipOutline, configNode);
     if (! outline.isVoid())
-        tooltip.getLookAndFeel().setColour (juce::TooltipWindow::outlineColourId, Stylesheet::parseColour (outline));
+        tooltip.setColour (juce::TooltipWindow::outlineColourId, Stylesheet::parseColour (outline));
 
     for (const auto& child : *this)
         child->updateColours();
@@ -40,14 +40,13 @@ Stylesheet::Stylesheet (MagicGUIBuilder& builderToUse) : builder (builderToUse)
 {
     setColourPalette();
 
+    // this includes the palettes
     currentStyle.addListener(this);
-    currentPalette.addListener(this);
 }
 
 Stylesheet::~Stylesheet()
 {
     currentStyle.removeListener(this);
-    currentPalette.removeListener(this);
 }
 
 void Stylesheet::setStyle (const juce::ValueTree& node)
@@ -58,11 +57,30 @@ void Stylesheet::setStyle (const juce::ValueTree& node)
 
 bool Stylesheet::setMediaSize (int width, int height)
 {
+    const auto unchanged = validMediaRanges.width.contains (width) &&
+                           validMediaRanges.height.contains (height);
+
+    changedMediaClasses.clear();
+
+    if (! unchanged)
+    {
+        for (const auto& name : mediaClasses)
+        {
+            const auto& styleClass = styleClasses [name];
+            if (styleClass->isValidForSize (mediaWidth, mediaHeight) != styleClass->isValidForSize (width, height))
+                changedMediaClasses.add (name);
+        }
+    }
+
     mediaWidth = width;
     mediaHeight = height;
 
-    return (validMediaRanges.width.contains (width) &&
-            validMediaRanges.height.contains (height));
+    return unchanged;
+}
+
+const juce::StringArray& Stylesheet::getChangedMediaClasses() const
+{
+    return changedMediaClasses;
 }
 
 void Stylesheet::setColourPalette ()
@@ -76,8 +94,56 @@ void Stylesheet::setColourPalette ()
     if (palettesNode.getNumChildren() == 0)
         palettesNode.appendChild (juce::ValueTree ("default"), undo);
 
-    currentPalette = palettesNode.getChild (0);
-    currentPalette.addListener (this);
+    currentPalette = palettesNode.getChildWithName (palettesNode.getProperty (IDs::selected).toString());
+    if (! currentPalette.isValid())
+        currentPalette = palettesNode.getChild (0);
+
+    compilePalette();
+}
+
+bool Stylesheet::setActivePalette (const juce::String& name)
+{
+    auto palettesNode = currentStyle.getChildWithName (IDs::palettes);
+    auto palette = palettesNode.getChildWithName (name);
+    if (! palette.isValid())
+        return false;
+
+    // store the selection, so setColourPalette() and a reload keep it
+    palettesNode.setProperty (IDs::selected, name, nullptr);
+
+    if (palette != currentPalette)
+    {
+        currentPalette = palette;
+        compilePalette();
+        builder.updateColours();
+    }
+
+    return true;
+}
+
+juce::StringArray Stylesheet::getPaletteNames() const
+{
+    juce::StringArray names;
+
+    for (const auto& palette : currentStyle.getChildWithName (IDs::palettes))
+        names.add (palette.getType().toString());
+
+    return names;
+}
+
+void Stylesheet::compilePalette()
+{
+    compiledPalette.clear();
+    parsedColours.clear();
+
+    if (! currentPalette.isValid())
+        return;
+
+    for (int i = 0; i < currentPalette.getNumProperties(); ++i)
+    {
+        const auto name = currentPalette.getPropertyName (i);
+        compiledPalette [name.toString()] = parseColour (currentPalette.getProperty (name).toString());
+    }
 }
 
 void Stylesheet::addPaletteEntry (const juce::String& name, juce::Colour colour, bool keepIfExists)
@@ -105,41 +171,157 @@ juce::ValueTree Stylesheet::getCurrentPalette()
     return currentPalette;
 }
 
-void Stylesheet::valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier& name)
+void Stylesheet::valueTreePropertyChanged (juce::ValueTree& treeThatChanged, const juce::Identifier& name)
 {
-    if (name.toString().contains("color"))
+    const auto coloursOnly = name.toString().contains ("color");
+
+    // find the type, id or class node and the section it lives in
+    juce::ValueTree entry;
+    auto section = treeThatChanged;
+    while (section.isValid() && section.getParent() != currentStyle)
+    {
+        entry   = section;
+        section = section.getParent();
+    }
+
+    if (section.getType() == IDs::palettes)
+    {
+        if (entry.isValid() && entry != currentPalette)
+            return;
+
+        if (entry.isValid())
+            compilePalette();
+        else if (name == IDs::selected)
+            setColourPalette();
+
+        builder.updateColours();
+        return;
+    }
+
+    if (entry.isValid())
+    {
+        const auto structural = name == IDs::active || name == IDs::recursive || treeThatChanged.getType() == IDs::media;
+
+        if (section.getType() == IDs::types)
+        {
+            updateRegisteredItems (itemsByType [entry.getType()], coloursOnly);
+            return;
+        }
+
+        if (section.getType() == IDs::nodes)
+        {
+            updateRegisteredItems (itemsById [entry.getType().toString()], coloursOnly);
+            return;
+        }
+
+        if (section.getType() == IDs::classes && ! structural)
+        {
+            updateRegisteredItems (itemsByClass [entry.getType().toString()], coloursOnly);
+            return;
+        }
+    }
+
+    if (coloursOnly)
         builder.updateColours();
     else
         builder.updateComponents();
 }
 
-void Stylesheet::updateValidRanges()
+void Stylesheet::updateRegisteredItems (const juce::Array<GuiItem*>& items, bool coloursOnly)
 {
-    validMediaRanges = Stylesheet::SizeRange();
+    if (coloursOnly)
+    {
+        for (auto* item : items)
+            item->updateColours();
+
+        return;
+    }
+
+    // updating a Container might recreate or recycle its children, so the items can be deleted or unregistered meanwhile
+    std::vector<juce::Component::SafePointer<GuiItem>> itemsToUpdate (items.begin(), items.end());
+    std::vector<juce::Component::SafePointer<Container>> containersToLayout;
 
-    for (const auto& styleClass : styleClasses)
+    for (auto& item : itemsToUpdate)
     {
-        const auto range = styleClass.second->getValidSizeRange();
-
-        if (mediaWidth < range.width.getStart())
-            validMediaRanges.width.setEnd (std::min (validMediaRanges.width.getEnd(), range.width.getStart()));
-        else if (mediaWidth < range.width.getEnd())
-            validMediaRanges.width = validMediaRanges.width.getIntersectionWith (range.width);
-        else
-            validMediaRanges.width.setStart (std::max (validMediaRanges.width.getStart(), range.width.getEnd()));
-
-        if (mediaHeight < range.height.getStart())
-            validMediaRanges.height.setEnd (std::min (validMediaRanges.height.getEnd(), range.height.getStart()));
-        else if (mediaHeight < range.height.getEnd())
-            validMediaRanges.height = validMediaRanges.height.getIntersectionWith (range.height);
-        else
-            validMediaRanges.height.setStart (std::max (validMediaRanges.height.getStart(), range.height.getEnd()));
+        if (item == nullptr || registeredItems.find (item.getComponent()) == registeredItems.end())
+            continue;
+
+        item->updateInternal();
+
+        if (item == nullptr)
+            continue;
+
+        if (auto* container = item->findParentComponentOfClass<Container>())
+            if (std::find (containersToLayout.begin(), containersToLayout.end(), container) == containersToLayout.end())
+                containersToLayout.emplace_back (container);
     }
+
+    for (auto& container : containersToLayout)
+        if (container != nullptr)
+            container->updateLayout();
+}
+
+void Stylesheet::registerItem (GuiItem* item)
+{
+    unregisterItem (item);
+
+    const auto& node = item->getConfigNode();
+
+    ItemKeys keys;
+    keys.type = node.getType();
+    keys.id = node.getProperty (IDs::id).toString();
+    keys.classes = juce::StringArray::fromTokens (node.getProperty (IDs::styleClass).toString(), " ", {});
+    keys.classes.removeEmptyStrings();
+    keys.classes.removeDuplicates (false);
+
+    itemsByType [keys.type].add (item);
+
+    if (keys.id.isNotEmpty())
+        itemsById [keys.id].add (item);
+
+    for (const auto& className : keys.classes)
+        itemsByClass [className].add (item);
+
+    registeredItems [item] = std::move (keys);
+}
+
+void Stylesheet::unregisterItem (GuiItem* item)
+{
+    auto registered = registeredItems.find (item);
+    if (registered == registeredItems.end())
+        return;
+
+    itemsByType [registered->second.type].removeFirstMatchingValue (item);
+
+    if (registered->second.id.isNotEmpty())
+        itemsById [registered->second.id].removeFirstMatchingValue (item);
+
+    for (const auto& className : registered->second.classes)
+        itemsByClass [className].removeFirstMatchingValue (item);
+
+    registeredItems.erase (registered);
+}
+
+static juce::Range<int> getRangeBetweenBreakpoints (const std::vector<int>& breakpoints, int value)
+{
+    const auto next = std::upper_bound (breakpoints.begin(), breakpoints.end(), value);
+
+    return { next == breakpoints.begin() ? 0 : *std::prev (next),
+             next == breakpoints.end() ? std::numeric_limits<int>::max() : *next };
+}
+
+void Stylesheet::updateValidRanges()
+{
+    validMediaRanges.width  = getRangeBetweenBreakpoints (widthBreakpoints, mediaWidth);
+    validMediaRanges.height = getRangeBetweenBreakpoints (heightBreakpoints, mediaHeight);
 }
 
 void Stylesheet::updateStyleClasses()
 {
     styleClasses.clear();
+    mediaClasses.clear();
+    widthBreakpoints.clear();
+    heightBreakpoints.clear();
 
     for (const auto& styleNode : currentStyle.getChildWithName (IDs::classes))
     {
@@ -152,8 +334,26 @@ void Stylesheet::updateStyleClasses()
             styleClass->addChangeListener (&builder);
         }
 
+        if (styleClass->hasMediaQuery())
+        {
+            // the properties can only change when the size crosses one of these values
+            const auto range = styleClass->getValidSizeRange();
+            widthBreakpoints.push_back (range.width.getStart());
+            widthBreakpoints.push_back (range.width.getEnd());
+            heightBreakpoints.push_back (range.height.getStart());
+            heightBreakpoints.push_back (range.height.getEnd());
+
+            mediaClasses.add (styleNode.getType().toString());
+        }
+
         styleClasses [styleNode.getType().toString()] = std::move (styleClass);
     }
+
+    for (auto* breakpoints : { &widthBreakpoints, &heightBreakpoints })
+    {
+        std::sort (breakpoints->begin(), breakpoints->end());
+        breakpoints->erase (std::unique (breakpoints->begin(), breakpoints->end()), breakpoints->end());
+    }
 }
 
 juce::var Stylesheet::getStyleProperty (const juce::Identifier& name, const juce::ValueTree& node, bool inherit, juce::ValueTree* definedHere) const
@@ -252,16 +452,25 @@ juce::Colour Stylesheet::getColour (const juce::String& name) const
 
     if (name [0] == '$')
     {
-        if (currentPalette.isValid())
-        {
-            auto value = currentPalette.getProperty (name.substring (1), "00000000").toString();
-            return Stylesheet::parseColour (value);
-        }
+        const auto entry = compiledPalette.find (name.substring (1));
+        if (entry != compiledPalette.end())
+            return entry->second;
 
         return juce::Colours::transparentBlack;
     }
 
-    return Stylesheet::parseColour (name);
+    const auto parsed = parsedColours.find (name);
+    if (parsed != parsedColours.end())
+        return parsed->second;
+
+    const auto colour = Stylesheet::parseColour (name);
+
+    // any string can be looked up, e.g. while editing, so the cache is bounded
+    if (parsedColours.size() >= maxParsedColours)
+        parsedColours.clear();
+
+    parsedColours [name] = colour;
+    return colour;
 }
 
 juce::Colour Stylesheet::parseColour (const juce::String& name)
@@ -284,6 +493,9 @@ juce::LookAndFeel* Stylesheet::getLookAndFeel (const juce::ValueTree& node) cons
         const auto& it = lookAndFeels.find (lnf);
         if (it != lookAndFeels.end())
             return it->second.get();
+
+        if (useSharedLookAndFeels)
+            return sharedLookAndFeels->getLookAndFeel (lnf);
     }
 
     return nullptr;
@@ -295,6 +507,10 @@ juce::StringArray Stylesheet::getLookAndFeelNames() const
     for (const auto& it : lookAndFeels)
         names.add (it.first);
 
+    if (useSharedLookAndFeels)
+        names.addArray (sharedLookAndFeels->getLookAndFeelNames());
+
+    names.removeDuplicates (false);
     return names;
 }
 
@@ -345,6 +561,11 @@ void Stylesheet::registerLookAndFeel (juce::String name, std::unique_ptr<juce::L
     lookAndFeels [name] = std::move (lookAndFeel);
 }
 
+void Stylesheet::setUseSharedLookAndFeels (bool shouldUseShared)
+{
+    useSharedLookAndFeels = shouldUseShared;
+}
+
 bool Stylesheet::isClassNode (const juce::ValueTree& node) const
 {
     auto testParent = currentStyle.getChildWithName (IDs::classes);
@@ -412,6 +633,7 @@ Stylesheet::StyleClass::StyleClass (juce::ValueTree style)
     const auto media = styleNode.getChildWithName (IDs::media);
     if (media.isValid())
     {
+        mediaQuery = true;
         validRange.width.setStart (media.getProperty (IDs::minWidth, 0));
         validRange.width.setEnd (media.getProperty (IDs::maxWidth, std::numeric_limits<int>::max()));
         validRange.height.setStart (media.getProperty (IDs::minHeight, 0));
@@ -429,6 +651,11 @@ bool Stylesheet::StyleClass::isValidForSize (int width, int height) const
     return validRange.width.contains (width) && validRange.height.contains (height);
 }
 
+bool Stylesheet::StyleClass::hasMediaQuery() const
+{
+    return mediaQuery;
+}
+
 bool Stylesheet::StyleClass::isActive() const
 {
     return activeFlag.getValue();
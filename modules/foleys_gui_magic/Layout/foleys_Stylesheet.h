@@ -35,10 +35,13 @@
 
 #include <juce_data_structures/juce_data_structures.h>
 
+#include "../LookAndFeels/foleys_LookAndFeelRegistry.h"
+
 namespace foleys
 {
 
 class MagicGUIBuilder;
+class GuiItem;
 
 /**
  The Stylesheet class represents all style information. It is organised in
@@ -71,16 +74,37 @@ public:
      */
     void updateValidRanges();
 
+    /**
+     After setMediaSize() returned false, this returns the names of the style classes that became valid
+     or invalid by the size change. Only nodes referencing one of these classes need to be updated.
+     */
+    const juce::StringArray& getChangedMediaClasses() const;
+
     /**
      Read the style classes and connect variables
      */
     void updateStyleClasses();
 
     /**
-     Updates the colourPalette
+     Updates the colourPalette. This selects the palette named in the selected property of the palettes node,
+     or the first palette if none is selected.
      */
     void setColourPalette ();
 
+    /**
+     Switch the colour palette at runtime, e.g. to change between a dark and a light theme.
+     Only the colours of the components are updated, the layout and components stay untouched.
+
+     @param name the name of the palette node
+     @return true, if a palette with that name existed
+     */
+    bool setActivePalette (const juce::String& name);
+
+    /**
+     Returns the names of all palettes in the current style
+     */
+    juce::StringArray getPaletteNames() const;
+
     void addPaletteEntry (const juce::String& name, juce::Colour colour, bool keepIfExists);
     juce::ValueTree getCurrentPalette();
 
@@ -112,8 +136,11 @@ public:
      useful, if you have added any actual images into the BinaryData and have enabled the
      FOLEYS_ENABLE_BINARY_DATA setting in the module page.
 
+     The Decorator gets the image from the ResourceImageCache in its drawn size instead.
+
      @param node is the node in the GUI DOM
      */
+    [[deprecated ("Use ResourceImageCache::getScaledImage() with the background-image property")]]
     juce::Image getBackgroundImage (const juce::ValueTree& node) const;
 
     /**
@@ -156,6 +183,13 @@ public:
      */
     void registerLookAndFeel (juce::String name, std::unique_ptr<juce::LookAndFeel> lookAndFeel);
 
+    /**
+     Allows referencing the LookAndFeels of the process wide LookAndFeelRegistry. Those are shared with
+     all other Stylesheets and only created when referenced. A LookAndFeel registered with
+     registerLookAndFeel() is found first.
+     */
+    void setUseSharedLookAndFeels (bool shouldUseShared);
+
     juce::StringArray getAllClassesNames() const;
 
     juce::StringArray getLookAndFeelNames() const;
@@ -168,7 +202,26 @@ public:
     void addListener (juce::ValueTree::Listener* listener);
     void removeListener (juce::ValueTree::Listener* listener);
 
+    /**
+     Registers a GuiItem by the type, id and classes of its node. When a type, id or class node in the style
+     changes, only the items registered for that name are updated.
+     Call this again when the id or class of the item's node changed.
+     */
+    void registerItem (GuiItem* item);
+
+    /**
+     Removes the item from the index. This is called by the GuiItem's destructor.
+     */
+    void unregisterItem (GuiItem* item);
+
 private:
+    void updateRegisteredItems (const juce::Array<GuiItem*>& items, bool coloursOnly);
+
+    /**
+     Parses all entries of the current palette, so getColour() doesn't need to parse strings
+     */
+    void compilePalette();
+
     void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override;
 
     void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override {}
@@ -193,6 +246,7 @@ private:
         bool isActive() const;
         bool isRecursive() const;
         bool isValidForSize (int width, int height) const;
+        bool hasMediaQuery() const;
 
         SizeRange getValidSizeRange() const;
 
@@ -205,6 +259,7 @@ private:
 
         SizeRange   validRange;
         bool        recursive  { false };
+        bool        mediaQuery { false };
     };
 
     MagicGUIBuilder&  builder;
@@ -212,7 +267,15 @@ private:
     juce::ValueTree   currentStyle;
     juce::ValueTree   currentPalette;
 
+    std::map<juce::String, juce::Colour>         compiledPalette;
+    mutable std::map<juce::String, juce::Colour> parsedColours;
+
+    static constexpr size_t maxParsedColours = 256;
+
     std::map<juce::String, std::unique_ptr<juce::LookAndFeel>> lookAndFeels;
+    juce::SharedResourcePointer<LookAndFeelRegistry>           sharedLookAndFeels;
+    bool                                                       useSharedLookAndFeels = false;
+
     std::map<juce::String, std::unique_ptr<StyleClass>> styleClasses;
 
     int mediaWidth = 0;
@@ -220,6 +283,23 @@ private:
 
     SizeRange validMediaRanges;
 
+    std::vector<int>  widthBreakpoints;
+    std::vector<int>  heightBreakpoints;
+    juce::StringArray mediaClasses;
+    juce::StringArray changedMediaClasses;
+
+    struct ItemKeys
+    {
+        juce::Identifier  type;
+        juce::StringArray classes;
+        juce::String      id;
+    };
+
+    std::map<GuiItem*, ItemKeys>                      registeredItems;
+    std::map<juce::Identifier, juce::Array<GuiItem*>> itemsByType;
+    std::map<juce::String, juce::Array<GuiItem*>>     itemsById;
+    std::map<juce::String, juce::Array<GuiItem*>>     itemsByClass;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Stylesheet)
 };
 
@@ -42,81 +42,113 @@ void LookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
     const auto outline = slider.findColour (juce::Slider::rotarySliderOutlineColourId);
     const auto fill    = slider.findColour (juce::Slider::rotarySliderFillColourId);
     const auto text    = slider.findColour (juce::Slider::textBoxTextColourId);
+    const auto enabled = slider.isEnabled();
 
     auto bounds = juce::Rectangle<int> (x, y, width, height).toFloat().reduced (10);
-    auto centre = bounds.getCentre();
 
     const auto tickHeight = 6;
     const auto tickWidth  = 40;
 
     auto radius = juce::jmin (bounds.getWidth() / 2.0f, bounds.getHeight() / 2.0f);
 
-    g.setColour (text);
-    if (radius > tickWidth * 2.0f + 10.0f)
+    const auto labelBounds = bounds;
+    const auto drawLabels  = radius > tickWidth * 2.0f + 10.0f;
+    if (drawLabels)
     {
-        const auto xLeft  = int (bounds.getX());
-        const auto xRight = int (bounds.getRight() - tickWidth);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.5f)),   int (centre.getX() - tickWidth / 2), int (bounds.getY()), tickWidth, tickHeight, juce::Justification::centred, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.375f)), xLeft,  int (bounds.getY()), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.25f)),  xLeft,  int (juce::jmap (0.33f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.125f)), xLeft,  int (juce::jmap (0.66f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.0f)),   xLeft,  int (bounds.getBottom() - tickHeight), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.625f)), xRight, int (bounds.getY()), tickWidth, tickHeight, juce::Justification::right, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.75f)),  xRight, int (juce::jmap (0.33f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::right, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.875f)), xRight, int (juce::jmap (0.66f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::right, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (1.0f)),   xRight, int (bounds.getBottom() - tickHeight), tickWidth, tickHeight, juce::Justification::right, 1);
-
         bounds.removeFromTop (tickHeight + 4.0f);
         bounds.reduce (tickWidth, 0.0f);
     }
 
     radius = juce::jmin (bounds.getWidth() / 2.0f, bounds.getHeight() / 2.0f);
-    centre = bounds.getCentre();
+    const auto centre = bounds.getCentre();
 
-    if (radius > 50.0f)
-    {
-        for (int i = 0; i < 9; ++i)
-        {
-            const auto angle = juce::jmap (i / 8.0f, rotaryStartAngle, rotaryEndAngle);
-            const auto point = centre.getPointOnCircumference (radius - 2.0f, angle);
-            g.fillEllipse (point.getX() - 3, point.getY() - 3, 6, 6);
-        }
+    const auto tickRadius = radius;
+    const auto drawTicks  = radius > 50.0f;
+    if (drawTicks)
         radius -= 10.0f;
-    }
 
     auto toAngle = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
     auto lineW = juce::jmin (4.0f, radius * 0.5f);
     auto arcRadius  = radius - lineW;
+    auto knobRadius = std:: max (radius - 3.0f * lineW, 10.0f);
+    auto ringRadius = std:: max (knobRadius - 4.0f, 10.0f);
+
+    // everything except the value arc and the pointer is drawn once into a shared image
+    auto key = ImageLayerCache::addToKey (juce::uint64 (0), juce::String ("FoleysFinestRotary"));
+    key = ImageLayerCache::addToKey (key, outline);
+    key = ImageLayerCache::addToKey (key, text);
+    key = ImageLayerCache::addToKey (key, enabled);
+    key = ImageLayerCache::addToKey (key, rotaryStartAngle);
+    key = ImageLayerCache::addToKey (key, rotaryEndAngle);
+
+    static const SliderLabels noLabels;
+    const auto& labelTexts = drawLabels ? getSliderLabels (slider) : noLabels;
+    const auto& labels     = labelTexts.labels;
+    key = ImageLayerCache::addToKey (key, labelTexts.joined);
+
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto staticLayer = layerCache->getImage (key, width, height, scale, [&] (juce::Graphics& layer)
+    {
+        layer.addTransform (juce::AffineTransform::translation (float (-x), float (-y)));
 
-    juce::Path backgroundArc;
-    backgroundArc.addCentredArc (bounds.getCentreX(),
-                                 bounds.getCentreY(),
-                                 arcRadius,
-                                 arcRadius,
-                                 0.0f,
-                                 rotaryStartAngle,
-                                 rotaryEndAngle,
-                                 true);
+        layer.setColour (text);
+        if (drawLabels)
+        {
+            const auto xLeft  = int (labelBounds.getX());
+            const auto xRight = int (labelBounds.getRight() - tickWidth);
+            layer.drawFittedText (labels [4], int (labelBounds.getCentreX() - tickWidth / 2), int (labelBounds.getY()), tickWidth, tickHeight, juce::Justification::centred, 1);
+            layer.drawFittedText (labels [3], xLeft,  int (labelBounds.getY()), tickWidth, tickHeight, juce::Justification::left, 1);
+            layer.drawFittedText (labels [2], xLeft,  int (juce::jmap (0.33f,  float (labelBounds.getY()), labelBounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::left, 1);
+            layer.drawFittedText (labels [1], xLeft,  int (juce::jmap (0.66f,  float (labelBounds.getY()), labelBounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::left, 1);
+            layer.drawFittedText (labels [0], xLeft,  int (labelBounds.getBottom() - tickHeight), tickWidth, tickHeight, juce::Justification::left, 1);
+            layer.drawFittedText (labels [5], xRight, int (labelBounds.getY()), tickWidth, tickHeight, juce::Justification::right, 1);
+            layer.drawFittedText (labels [6], xRight, int (juce::jmap (0.33f,  float (labelBounds.getY()), labelBounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::right, 1);
+            layer.drawFittedText (labels [7], xRight, int (juce::jmap (0.66f,  float (labelBounds.getY()), labelBounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::right, 1);
+            layer.drawFittedText (labels [8], xRight, int (labelBounds.getBottom() - tickHeight), tickWidth, tickHeight, juce::Justification::right, 1);
+        }
 
-    g.setColour (outline);
-    g.strokePath (backgroundArc, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::butt));
+        if (drawTicks)
+        {
+            for (int i = 0; i < 9; ++i)
+            {
+                const auto angle = juce::jmap (i / 8.0f, rotaryStartAngle, rotaryEndAngle);
+                const auto point = centre.getPointOnCircumference (tickRadius - 2.0f, angle);
+                layer.fillEllipse (point.getX() - 3, point.getY() - 3, 6, 6);
+            }
+        }
+
+        juce::Path backgroundArc;
+        backgroundArc.addCentredArc (bounds.getCentreX(),
+                                     bounds.getCentreY(),
+                                     arcRadius,
+                                     arcRadius,
+                                     0.0f,
+                                     rotaryStartAngle,
+                                     rotaryEndAngle,
+                                     true);
+
+        layer.setColour (outline);
+        layer.strokePath (backgroundArc, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::butt));
 
-    auto knobRadius = std:: max (radius - 3.0f * lineW, 10.0f);
-    {
-        juce::Graphics::ScopedSaveState saved (g);
-        if (slider.isEnabled())
         {
-            juce::ColourGradient fillGradient (outline.brighter(), centre.getX() + lineW * 2.0f, centre.getY() - lineW * 4.0f, outline, centre.getX() + knobRadius, centre.getY() + knobRadius, true);
-            g.setGradientFill (fillGradient);
+            juce::Graphics::ScopedSaveState saved (layer);
+            if (enabled)
+            {
+                juce::ColourGradient fillGradient (outline.brighter(), centre.getX() + lineW * 2.0f, centre.getY() - lineW * 4.0f, outline, centre.getX() + knobRadius, centre.getY() + knobRadius, true);
+                layer.setGradientFill (fillGradient);
+            }
+            layer.fillEllipse (centre.getX() - knobRadius, centre.getY() - knobRadius, knobRadius * 2.0f, knobRadius * 2.0f);
         }
-        g.fillEllipse (centre.getX() - knobRadius, centre.getY() - knobRadius, knobRadius * 2.0f, knobRadius * 2.0f);
-    }
 
-    knobRadius = std:: max (knobRadius - 4.0f, 10.0f);
+        layer.setColour (outline.brighter());
+        layer.drawEllipse (centre.getX() - ringRadius, centre.getY() - ringRadius, ringRadius * 2.0f, ringRadius * 2.0f, 2.0f);
+    }, labelTexts.joined);
+
+    g.drawImage (staticLayer, juce::Rectangle<int> (x, y, width, height).toFloat());
+
     g.setColour (outline.brighter());
-    g.drawEllipse (centre.getX() - knobRadius, centre.getY() - knobRadius, knobRadius * 2.0f, knobRadius * 2.0f, 2.0f);
 
-    if (slider.isEnabled() && arcRadius > 10.0f)
+    if (enabled && arcRadius > 10.0f)
     {
         juce::Path valueArc;
         valueArc.addCentredArc (bounds.getCentreX(),
@@ -133,11 +165,53 @@ void LookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
     }
 
     juce::Path p;
-    p.startNewSubPath (centre.getPointOnCircumference (knobRadius - lineW, toAngle));
-    p.lineTo (centre.getPointOnCircumference ((knobRadius - lineW) * 0.6f, toAngle));
+    p.startNewSubPath (centre.getPointOnCircumference (ringRadius - lineW, toAngle));
+    p.lineTo (centre.getPointOnCircumference ((ringRadius - lineW) * 0.6f, toAngle));
     g.strokePath (p, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
 }
 
+const LookAndFeel::SliderLabels& LookAndFeel::getSliderLabels (juce::Slider& slider)
+{
+    auto signature = ImageLayerCache::addToKey (juce::uint64 (0), slider.getMinimum());
+    signature = ImageLayerCache::addToKey (signature, slider.getMaximum());
+    signature = ImageLayerCache::addToKey (signature, slider.getInterval());
+    signature = ImageLayerCache::addToKey (signature, slider.getSkewFactor());
+    signature = ImageLayerCache::addToKey (signature, slider.getNumDecimalPlacesToDisplay());
+    signature = ImageLayerCache::addToKey (signature, slider.getTextValueSuffix());
+
+    // all parameter attachments use the same lambda type, so the texts tell a rebound slider apart
+    const auto minText = slider.getTextFromValue (slider.getMinimum());
+    const auto maxText = slider.getTextFromValue (slider.getMaximum());
+
+    auto& entry = sliderLabels [&slider];
+
+    // a different slider can be created at the address of a deleted one
+    if (entry.slider != &slider || entry.signature != signature || entry.minText != minText || entry.maxText != maxText)
+    {
+        entry.slider    = &slider;
+        entry.signature = signature;
+        entry.minText   = minText;
+        entry.maxText   = maxText;
+        entry.joined.clear();
+
+        for (size_t i = 0; i < entry.labels.size(); ++i)
+        {
+            entry.labels [i] = slider.getTextFromValue (slider.proportionOfLengthToValue (float (i) / 8.0f));
+            entry.joined << entry.labels [i] << "\n";
+        }
+
+        for (auto it = sliderLabels.begin(); it != sliderLabels.end();)
+        {
+            if (it->second.slider == nullptr)
+                it = sliderLabels.erase (it);
+            else
+                ++it;
+        }
+    }
+
+    return entry;
+}
+
 //==============================================================================
 
 void LookAndFeel::drawComboBox (juce::Graphics& g, int width, int height, bool,
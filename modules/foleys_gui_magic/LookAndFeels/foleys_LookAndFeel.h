@@ -60,6 +60,24 @@ public:
     
 private:
 
+    /**
+     The texts of the labels around a rotary slider. They are only created again, if the range, suffix,
+     decimal places or the texts of the minimum and maximum of the slider changed.
+     */
+    struct SliderLabels
+    {
+        juce::Component::SafePointer<juce::Slider> slider;
+        juce::uint64                               signature = 0;
+        juce::String                               minText, maxText;
+        std::array<juce::String, 9>                labels;
+        juce::String                               joined;
+    };
+
+    const SliderLabels& getSliderLabels (juce::Slider& slider);
+
+    juce::SharedResourcePointer<ImageLayerCache> layerCache;
+    std::map<juce::Slider*, SliderLabels>        sliderLabels;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LookAndFeel)
 };
 
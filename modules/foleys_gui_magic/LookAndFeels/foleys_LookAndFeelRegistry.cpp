@@ -0,0 +1,94 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#include "foleys_LookAndFeelRegistry.h"
+
+namespace foleys
+{
+
+LookAndFeelRegistry::LookAndFeelRegistry()
+{
+    registerFactory ("LookAndFeel_V1", [] { return std::make_unique<juce::LookAndFeel_V1>(); });
+    registerFactory ("LookAndFeel_V2", [] { return std::make_unique<JuceLookAndFeel_V2>(); });
+    registerFactory ("LookAndFeel_V3", [] { return std::make_unique<JuceLookAndFeel_V3>(); });
+    registerFactory ("LookAndFeel_V4", [] { return std::make_unique<JuceLookAndFeel_V4>(); });
+    registerFactory ("FoleysFinest",   [] { return std::make_unique<LookAndFeel>(); });
+    registerFactory ("Skeuomorphic",   [] { return std::make_unique<Skeuomorphic>(); });
+}
+
+void LookAndFeelRegistry::registerFactory (const juce::String& name, Factory factory)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    if (entries.find (name) != entries.cend())
+    {
+        // You tried to register more than one LookAndFeel with the same name!
+        // That cannot work, the second LookAndFeel will be ignored
+        jassertfalse;
+        return;
+    }
+
+    entries [name].factory = std::move (factory);
+}
+
+bool LookAndFeelRegistry::contains (const juce::String& name) const
+{
+    return entries.find (name) != entries.cend();
+}
+
+juce::LookAndFeel* LookAndFeelRegistry::getLookAndFeel (const juce::String& name)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    auto it = entries.find (name);
+    if (it == entries.end())
+        return nullptr;
+
+    auto& entry = it->second;
+    if (entry.lookAndFeel == nullptr && entry.factory)
+        entry.lookAndFeel = entry.factory();
+
+    return entry.lookAndFeel.get();
+}
+
+juce::StringArray LookAndFeelRegistry::getLookAndFeelNames() const
+{
+    juce::StringArray names;
+    for (const auto& it : entries)
+        names.add (it.first);
+
+    return names;
+}
+
+} // namespace foleys
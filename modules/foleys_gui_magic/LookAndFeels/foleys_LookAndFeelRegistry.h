@@ -0,0 +1,87 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace foleys
+{
+
+/**
+ The LookAndFeelRegistry holds the LookAndFeels that are shared by all MagicGUIBuilders in the process.
+ Use it through a juce::SharedResourcePointer, so it is deleted when the last builder is gone.
+ The LookAndFeels are only created, when a stylesheet references them for the first time.
+
+ The bundled LookAndFeels are registered already. You can add your own using registerFactory().
+ Since the LookAndFeels are shared, don't set colours on them that are specific to one editor.
+ */
+class LookAndFeelRegistry
+{
+public:
+    using Factory = std::function<std::unique_ptr<juce::LookAndFeel>()>;
+
+    LookAndFeelRegistry();
+
+    /**
+     Register a LookAndFeel by name. The factory is called the first time the LookAndFeel is used.
+     */
+    void registerFactory (const juce::String& name, Factory factory);
+
+    /**
+     Returns true, if a LookAndFeel with that name can be created
+     */
+    bool contains (const juce::String& name) const;
+
+    /**
+     Returns the shared LookAndFeel with that name and creates it if necessary.
+     @return the LookAndFeel or nullptr, if no LookAndFeel with that name was registered
+     */
+    juce::LookAndFeel* getLookAndFeel (const juce::String& name);
+
+    juce::StringArray getLookAndFeelNames() const;
+
+private:
+    struct Entry
+    {
+        Factory                            factory;
+        std::unique_ptr<juce::LookAndFeel> lookAndFeel;
+    };
+
+    std::map<juce::String, Entry> entries;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LookAndFeelRegistry)
+};
+
+} // namespace foleys
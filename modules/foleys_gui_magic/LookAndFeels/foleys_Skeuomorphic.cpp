@@ -71,26 +71,15 @@ static inline void fillEllipse (juce::Graphics& g, const juce::Rectangle<float>&
     g.fillEllipse (bounds);
 }
 
-const Skeuomorphic::knobImages& Skeuomorphic::getKnobImages (int diameter)
+void Skeuomorphic::drawKnobBackground (juce::Graphics& g, int diameter) const
 {
-    auto search = knobsBgs.find (diameter);
-    if (search != knobsBgs.end()) return search->second;
-
     float radius = diameter * 0.5f;
     bool isTiny  = diameter < 20;
-    bool isSmall = diameter < 60;
 
     juce::Point<float>     centre { radius, radius };
     juce::Rectangle<float> bounds { 0.0f, 0.0f, float (diameter), float (diameter) };
 
-    if (knobsBgs.size() > size_t (knobsMaxSize))
-        knobsBgs.clear();
-
-
-    // background
-    juce::Image bg { juce::Image::ARGB, diameter, diameter + 3, true };
     {
-        juce::Graphics g (bg);
         fillEllipse (g, bounds.translated (0.0f, 1.0f), whiteA010);
         fillEllipse (g, bounds.translated (0.0f, 2.0f), whiteA010);
         fillEllipse (g, bounds,                         { 50, 51, 61});
@@ -107,16 +96,21 @@ const Skeuomorphic::knobImages& Skeuomorphic::getKnobImages (int diameter)
                                                   { 1.0,                          blackA092 } });
         fillEllipse (g, bounds, backgroundGr);
     }
+}
 
+void Skeuomorphic::drawKnobForeground (juce::Graphics& g, int diameter) const
+{
+    float radius = diameter * 0.5f;
+    bool isSmall = diameter < 60;
+
+    juce::Point<float>     centre { radius, radius };
+    juce::Rectangle<float> bounds { 0.0f, 0.0f, float (diameter), float (diameter) };
 
     bounds.reduce (diameter * 0.15f, diameter * 0.15f);
     auto fgRadius = bounds.getWidth() * 0.5f;
 
-
-    // foreground
-    juce::Image fg { juce::Image::ARGB, diameter, diameter, true };
     {
-        juce::Graphics g (fg); // lower shadow
+        // lower shadow
         {
             auto xOffset = fgRadius * 0.12f;
             auto yOffset = fgRadius * 0.32f;
@@ -154,9 +148,6 @@ const Skeuomorphic::knobImages& Skeuomorphic::getKnobImages (int diameter)
             g.drawEllipse (bounds, 1.0f);
         }
     }
-
-    knobsBgs.insert ({diameter, knobImages { std::move (bg), std::move (fg) }});
-    return knobsBgs.find (diameter)->second;
 }
 
 void Skeuomorphic::drawRotarySlider (juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
@@ -180,8 +171,20 @@ void Skeuomorphic::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
 
     const juce::Colour fill = slider.findColour (juce::Slider::rotarySliderFillColourId);
 
-    const knobImages& images = getKnobImages (diameter);
-    g.drawImageAt (images.backgroundImage, x, y);
+    // large knobs are drawn from images in steps of 4 pixels, so live resizing doesn't create an image for every size
+    const auto imageDiameter = diameter > 64 ? ((diameter + 2) / 4) * 4 : diameter;
+    const auto imageRatio    = float (diameter) / float (imageDiameter);
+    const auto scale         = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    auto backgroundKey = ImageLayerCache::addToKey (juce::uint64 (0), juce::String ("SkeuomorphicBackground"));
+    auto background    = layerCache->getImage (backgroundKey, imageDiameter, imageDiameter + 3, scale,
+                                               [&] (juce::Graphics& layer) { drawKnobBackground (layer, imageDiameter); });
+    {
+        // drawImage uses the opacity of the current colour
+        juce::Graphics::ScopedSaveState save (g);
+        g.setOpacity (1.0f);
+        g.drawImage (background, { float (x), float (y), float (diameter), float (imageDiameter + 3) * imageRatio });
+    }
 
     if (!isSmall) // marker dot
     {
@@ -240,8 +243,16 @@ void Skeuomorphic::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
     g.setColour (blackA092);
     g.drawEllipse (bounds, 1.0f);
 
-    g.setColour (juce::Colours::black);
-    if (!isTiny) g.drawImageAt (images.foregroundImage, x, y);
+    if (!isTiny)
+    {
+        auto foregroundKey = ImageLayerCache::addToKey (juce::uint64 (0), juce::String ("SkeuomorphicForeground"));
+        auto foreground    = layerCache->getImage (foregroundKey, imageDiameter, imageDiameter, scale,
+                                                   [&] (juce::Graphics& layer) { drawKnobForeground (layer, imageDiameter); });
+
+        juce::Graphics::ScopedSaveState save (g);
+        g.setOpacity (1.0f);
+        g.drawImage (foreground, bounds);
+    }
 }
 
 } // namespace foleys
@@ -0,0 +1,151 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#pragma once
+
+#include "foleys_PropertyHandle.h"
+
+#include <typeindex>
+
+namespace foleys
+{
+
+/**
+ Base class of the AudioToGuiChannels, so the AudioToGuiChannels can dispatch all of them.
+ */
+class AudioToGuiChannelBase
+{
+public:
+    AudioToGuiChannelBase() = default;
+    virtual ~AudioToGuiChannelBase() = default;
+
+    /**
+     Writes the value into the property, if a different value was published since the last call.
+     This must be called on the message thread.
+     */
+    void dispatch()
+    {
+        if (changed.exchange (false, std::memory_order_acquire))
+            dispatchValue();
+    }
+
+protected:
+    virtual void dispatchValue() = 0;
+
+    std::atomic<bool> changed { false };
+
+private:
+    JUCE_DECLARE_NON_COPYABLE (AudioToGuiChannelBase)
+};
+
+/**
+ An AudioToGuiChannel publishes a value from the audio thread to a property in the state, e.g. a gain reduction
+ or the number of active voices. Publishing is wait-free, the value is written into the property once per frame
+ on the message thread, and only if it changed. Widgets connected to that property are updated as usual.
+ */
+template <typename T>
+class AudioToGuiChannel : public AudioToGuiChannelBase
+{
+public:
+    static_assert (std::atomic<T>::is_always_lock_free, "The type of an AudioToGuiChannel must be lock free as std::atomic");
+
+    explicit AudioToGuiChannel (PropertyHandle<T> propertyToUse)
+      : property (std::move (propertyToUse))
+    {}
+
+    /**
+     Call this from the audio thread. It never locks nor allocates.
+     */
+    void publish (T newValue) noexcept
+    {
+        if (value.exchange (newValue, std::memory_order_relaxed) != newValue)
+            changed.store (true, std::memory_order_release);
+    }
+
+    /**
+     Returns the last published value
+     */
+    T getValue() const noexcept { return value.load (std::memory_order_relaxed); }
+
+private:
+    void dispatchValue() override
+    {
+        property.set (value.load (std::memory_order_relaxed));
+    }
+
+    std::atomic<T>    value {};
+    PropertyHandle<T> property;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioToGuiChannel)
+};
+
+/**
+ The AudioToGuiChannels is the registry of all AudioToGuiChannel of a MagicGUIState. Create the channels
+ on the message thread, e.g. in the constructor of your processor, and keep the reference for the audio thread.
+ The MagicPluginEditor calls dispatch() on each frame.
+ */
+class AudioToGuiChannels
+{
+public:
+    AudioToGuiChannels() = default;
+
+    /**
+     Returns the channel for that property and type, or creates it. A channel is never replaced, so it stays
+     valid as long as the AudioToGuiChannels exists. Asking for the same property with a different type
+     creates a separate channel writing to that property. Must be called on the message thread.
+     */
+    template <typename T>
+    AudioToGuiChannel<T>& getOrCreateChannel (const juce::String& pathToProperty, PropertyHandle<T> property)
+    {
+        auto& channel = channels [{ pathToProperty, std::type_index (typeid (T)) }];
+
+        if (channel == nullptr)
+            channel = std::make_unique<AudioToGuiChannel<T>> (std::move (property));
+
+        return static_cast<AudioToGuiChannel<T>&> (*channel);
+    }
+
+    /**
+     Copies the values, that were published since the last call, into the properties.
+     Must be called on the message thread.
+     */
+    void dispatch();
+
+private:
+    std::map<std::pair<juce::String, std::type_index>, std::unique_ptr<AudioToGuiChannelBase>> channels;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioToGuiChannels)
+};
+
+} // namespace foleys
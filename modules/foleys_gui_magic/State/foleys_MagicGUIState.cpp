@@ -87,6 +87,19 @@ void MagicGUIState::setGuiValueTree (const juce::ValueTree& dom)
 
 void MagicGUIState::setGuiValueTree (const char* data, int dataSize)
 {
+    // the binary format starts with the null terminated type name of the root node
+    const auto rootType   = IDs::magic.toString();
+    const auto headerSize = rootType.getNumBytesAsUTF8() + 1;
+
+    if (size_t (dataSize) > headerSize && std::memcmp (data, rootType.toRawUTF8(), headerSize) == 0)
+    {
+        auto dom = juce::ValueTree::readFromData (data, size_t (dataSize));
+        if (dom.isValid())
+            setGuiValueTree (dom);
+
+        return;
+    }
+
     juce::String text (data, size_t (dataSize));
     auto dom = juce::ValueTree::fromXml (text);
     if (dom.isValid())
@@ -121,23 +134,50 @@ juce::ValueTree& MagicGUIState::getSettings()
 }
 
 juce::Value MagicGUIState::getPropertyAsValue (const juce::String& pathToProperty)
+{
+    auto handle = getPropertyHandle<juce::var> (pathToProperty);
+    if (! handle.isValid())
+        return {};
+
+    return handle.getValue();
+}
+
+void MagicGUIState::addTransientNode (const juce::String& pathToNode)
+{
+    auto nodes = juce::StringArray::fromTokens (pathToNode, ":", "");
+    nodes.removeEmptyStrings();
+
+    // the properties at the root are saved, put transient properties into a node
+    if (nodes.isEmpty())
+    {
+        jassertfalse;
+        return;
+    }
+
+    transientNodes.addIfNotAlreadyThere (nodes.joinIntoString (":"));
+}
+
+void MagicGUIState::addTransientProperty (const juce::String& pathToProperty)
 {
     auto path = juce::StringArray::fromTokens (pathToProperty, ":", "");
     path.removeEmptyStrings();
 
-    if (path.size() == 0)
-        return {};
+    if (path.isEmpty())
+        return;
 
-    auto tree = getPropertyRoot();
+    transientPropertyPaths.addIfNotAlreadyThere (path.joinIntoString (":"));
+}
 
-    for (int i = 0; i < path.size() - 1 && tree.isValid(); ++i)
-        tree = tree.getOrCreateChildWithName (path [i], nullptr);
+bool MagicGUIState::isTransientProperty (const juce::String& pathToProperty) const
+{
+    auto path = juce::StringArray::fromTokens (pathToProperty, ":", "");
+    path.removeEmptyStrings();
 
-    auto propName = path [path.size()-1];
-    if (!tree.hasProperty (propName))
-        tree.setProperty (propName, {}, nullptr);
+    if (transientPropertyPaths.contains (path.joinIntoString (":")))
+        return true;
 
-    return tree.getPropertyAsValue (propName, nullptr);
+    path.removeRange (path.size() - 1, 1);
+    return transientNodes.contains (path.joinIntoString (":"));
 }
 
 juce::StringArray MagicGUIState::getParameterNames() const
@@ -147,12 +187,14 @@ juce::StringArray MagicGUIState::getParameterNames() const
 
 void MagicGUIState::populatePropertiesMenu (juce::ComboBox& comboBox) const
 {
+    addTransientPropertiesToMenu (comboBox, *comboBox.getRootMenu());
     addPropertiesToMenu (getPropertyRoot(), comboBox, *comboBox.getRootMenu(), {});
 }
 
 juce::PopupMenu MagicGUIState::createPropertiesMenu (juce::ComboBox& combo) const
 {
     juce::PopupMenu menu;
+    addTransientPropertiesToMenu (combo, menu);
     addPropertiesToMenu (getPropertyRoot(), combo, menu, {});
     return menu;
 }
@@ -223,6 +265,26 @@ void MagicGUIState::addPropertiesToMenu (const juce::ValueTree& tree, juce::Comb
     });
 }
 
+void MagicGUIState::addTransientPropertiesToMenu (juce::ComboBox& combo, juce::PopupMenu& menu) const
+{
+    for (const auto& child : transientProperties)
+    {
+        const auto name = child.getType().toString();
+        juce::PopupMenu subMenu;
+        addPropertiesToMenu (child, combo, subMenu, name + ":");
+        menu.addSubMenu (name, subMenu);
+    }
+
+    for (int i=0; i < transientProperties.getNumProperties(); ++i)
+    {
+        const auto name = transientProperties.getPropertyName (i).toString();
+        menu.addItem (name, true, false, [&combo, name]
+        {
+            combo.setText (name);
+        });
+    }
+}
+
 void MagicGUIState::prepareToPlay (double sampleRate, int samplesPerBlockExpected)
 {
     for (auto& plot : advertisedObjects)
@@ -235,6 +297,16 @@ juce::MidiKeyboardState& MagicGUIState::getKeyboardState()
     return keyboardState;
 }
 
+MidiNoteState& MagicGUIState::getNoteState()
+{
+    return noteState;
+}
+
+AudioToGuiChannels& MagicGUIState::getAudioToGuiChannels()
+{
+    return audioToGuiChannels;
+}
+
 #if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
 void MagicGUIState::setResourcesFolder (const juce::String& source)
 {
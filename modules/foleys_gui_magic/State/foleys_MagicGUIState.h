@@ -37,6 +37,9 @@
 
 #include "../Visualisers/foleys_MagicPlotSource.h"
 #include "../General/foleys_StringDefinitions.h"
+#include "foleys_MidiNoteState.h"
+#include "foleys_PropertyHandle.h"
+#include "foleys_AudioToGuiChannels.h"
 
 namespace foleys
 {
@@ -79,6 +82,11 @@ public:
      Set the GUI DOM to create the GUI components from
      */
     void setGuiValueTree (const juce::ValueTree& dom);
+
+    /**
+     Set the GUI DOM from memory, e.g. from BinaryData. This can be either the XML saved from the
+     designer, or the binary ValueTree format created by the CMake function pgm_add_binary_gui_tree().
+     */
     void setGuiValueTree (const char* data, int dataSize);
     void setGuiValueTree (const juce::File& file);
 
@@ -135,6 +143,36 @@ public:
      */
     juce::Value getPropertyAsValue (const juce::String& pathToProperty);
 
+    /**
+     Returns a handle to a property inside the ValueTreeState. The path is parsed only once, so keep the handle
+     for properties that are read or written often. The nodes are a colon separated list, the last component is
+     the property name.
+     */
+    template <typename T>
+    PropertyHandle<T> getPropertyHandle (const juce::String& pathToProperty)
+    {
+        if (pathToProperty.removeCharacters (":").isEmpty())
+            return {};
+
+        if (isTransientProperty (pathToProperty))
+            return { transientProperties, pathToProperty };
+
+        return { state, IDs::properties.toString() + ":" + pathToProperty };
+    }
+
+    /**
+     The properties in this node are not saved with the state, e.g. values that are updated continuously
+     like the playhead. Set this up before any property of the node is used. The node path is a colon
+     separated list.
+     */
+    void addTransientNode (const juce::String& pathToNode);
+
+    /**
+     This single property is not saved with the state, the other properties of its node are.
+     Like addTransientNode(), set this up before the property is used.
+     */
+    void addTransientProperty (const juce::String& pathToProperty);
+
     /**
      Populates a menu with properties found in the persistent ValueTree
      */
@@ -221,8 +259,37 @@ public:
      */
     void addBackgroundProcessing (MagicPlotSource* source);
 
+    /**
+     Returns the keyboard state for the GUI widgets. It is updated from the audio thread
+     through the MidiNoteState and must only be used on the message thread. Widgets using it
+     call MidiNoteState::startMirroring() and stopMirroring().
+     */
     juce::MidiKeyboardState& getKeyboardState();
 
+    /**
+     The note state can be read from any thread without locking.
+     */
+    MidiNoteState& getNoteState();
+
+    /**
+     Creates a channel to publish values from the audio thread to a property, e.g. a gain reduction.
+     Call this on the message thread and keep the reference. AudioToGuiChannel::publish() is wait-free.
+     The nodes are a colon separated list, the last component is the property name. The property becomes
+     transient, so the published values are not saved with the state, see addTransientProperty().
+     */
+    template <typename T>
+    AudioToGuiChannel<T>& createAudioToGuiChannel (const juce::String& pathToProperty)
+    {
+        addTransientProperty (pathToProperty);
+        return audioToGuiChannels.getOrCreateChannel<T> (pathToProperty, getPropertyHandle<T> (pathToProperty));
+    }
+
+    /**
+     The MagicPluginEditor dispatches the channels on each frame. If you display the state in a different
+     Component, call dispatch() yourself.
+     */
+    AudioToGuiChannels& getAudioToGuiChannels();
+
     /**
      Return the referenced AudioProcessor, if this state can provide one
      */
@@ -240,6 +307,9 @@ private:
 
     void addParametersToMenu (const juce::AudioProcessorParameterGroup& group, juce::PopupMenu& menu, int& index) const;
     void addPropertiesToMenu (const juce::ValueTree& tree, juce::ComboBox& combo, juce::PopupMenu& menu, const juce::String& path) const;
+    void addTransientPropertiesToMenu (juce::ComboBox& combo, juce::PopupMenu& menu) const;
+
+    bool isTransientProperty (const juce::String& pathToProperty) const;
 
     /**
      The ApplicationSettings is used for settings e.g. over many plugin instances.
@@ -249,7 +319,14 @@ private:
     juce::ValueTree guiValueTree { IDs::magic };
     juce::ValueTree state        { "state" };
 
+    juce::ValueTree   transientProperties { IDs::properties };
+    juce::StringArray transientNodes;
+    juce::StringArray transientPropertyPaths;
+
     juce::MidiKeyboardState keyboardState;
+    MidiNoteState           noteState { keyboardState };
+
+    AudioToGuiChannels      audioToGuiChannels;
 
     std::map<juce::Identifier, std::function<void()>>       triggers;
 
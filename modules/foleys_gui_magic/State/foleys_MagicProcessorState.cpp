@@ -32,6 +32,7 @@
  */
 
 #include "foleys_MagicProcessorState.h"
+#include "../Helpers/foleys_ValueTreeHelpers.h"
 
 namespace foleys
 {
@@ -39,11 +40,24 @@ namespace foleys
 MagicProcessorState::MagicProcessorState (juce::AudioProcessor& processorToUse)
   : processor (processorToUse)
 {
+    // the playhead is updated continuously and not part of the saved state
+    addTransientNode ("playhead");
+
+    getValueTree().addListener (this);
 }
 
 MagicProcessorState::~MagicProcessorState()
 {
     stopTimer();
+    cancelPendingUpdate();
+
+    getValueTree().removeListener (this);
+    editedGuiTree.removeListener (this);
+    for (auto* parameter : observedParameters)
+        parameter->removeListener (this);
+
+    // the kept components refer to this state, so they need to go first
+    keptBuilder.reset();
 }
 
 juce::StringArray MagicProcessorState::getParameterNames() const
@@ -143,18 +157,287 @@ bool MagicProcessorState::getLastEditorSize (int& width, int& height)
     return true;
 }
 
+void MagicProcessorState::setKeepEditorAlive (bool shouldKeepAlive)
+{
+    keepEditorAlive = shouldKeepAlive;
+
+    if (! keepEditorAlive)
+        keptBuilder.reset();
+}
+
+bool MagicProcessorState::getKeepEditorAlive() const
+{
+    return keepEditorAlive;
+}
+
+void MagicProcessorState::keepGUIBuilder (std::unique_ptr<MagicGUIBuilder> builder)
+{
+    if (keepEditorAlive)
+        keptBuilder = std::move (builder);
+}
+
+std::unique_ptr<MagicGUIBuilder> MagicProcessorState::takeKeptGUIBuilder()
+{
+    return std::move (keptBuilder);
+}
+
 void MagicProcessorState::getStateInformation (juce::MemoryBlock& destData)
 {
-    auto newState = getValueTree();
-    parameters.saveParameterValues (newState);
+    // a GUI edit waiting to be written is referenced right away
+    if (juce::MessageManager::existsAndIsCurrentThread())
+        handleUpdateNowIfNeeded();
+
+    // hosts may ask from several threads at once, e.g. autosave next to the UI
+    const juce::ScopedLock cacheScope (cacheLock);
+
+    observeParameters();
+
+    // the parameter values are read after this, so a later change is saved next time
+    const auto parametersGeneration = parameterGeneration.load();
+    if (parametersGeneration != cachedParameterGeneration || stateGeneration.load() != cachedGeneration || cachedState.isEmpty())
+    {
+        const juce::ScopedLock lock (guiHashLock);
+        auto newState = getValueTree();
+
+        parameters.saveParameterValues (newState);
+
+        // a restored GUI, that isn't applied yet, keeps the reference of the restored state
+        if (editedGuiHash.isNotEmpty() && restoredGuiHash.isEmpty() && ! restoredGuiTree.isValid())
+        {
+            auto reference = newState.getOrCreateChildWithName (IDs::guiReference, nullptr);
+            reference.setProperty (IDs::guiHash, editedGuiHash, nullptr);
+            editedGuiHashSaved = true;
+        }
+
+        // writing the values into the tree increased the generation, so it is read afterwards
+        const auto generation = stateGeneration.load();
+
+        {
+            juce::MemoryOutputStream stream (cachedState, false);
+
+            if (compressState)
+            {
+                juce::GZIPCompressorOutputStream zipped (stream);
+                newState.writeToStream (zipped);
+            }
+            else
+            {
+                newState.writeToStream (stream);
+            }
+        }
+
+        cachedParameterGeneration = parametersGeneration;
+        cachedGeneration          = generation;
+    }
+
+    destData = cachedState;
+}
+
+void MagicProcessorState::markStateDirty()
+{
+    ++stateGeneration;
+}
+
+void MagicProcessorState::observeParameters()
+{
+    const auto& processorParameters = processor.getParameters();
+    if (int (observedParameters.size()) == processorParameters.size())
+        return;
+
+    for (auto* parameter : processorParameters)
+        if (observedParameters.insert (parameter).second)
+            parameter->addListener (this);
+
+    markStateDirty();
+}
+
+void MagicProcessorState::parameterValueChanged (int, float)
+{
+    // can be called on the audio thread
+    ++parameterGeneration;
+}
+
+void MagicProcessorState::treeChanged (const juce::ValueTree& tree)
+{
+    // the same listener observes the state and the edited GUI
+    if (editedGuiTree.isValid() && (tree == editedGuiTree || tree.isAChildOf (editedGuiTree)))
+    {
+        // the GUI is written once all edits of this message are done
+        editedGuiChanged = true;
+        triggerAsyncUpdate();
+        return;
+    }
+
+    markStateDirty();
+}
+
+void MagicProcessorState::valueTreePropertyChanged (juce::ValueTree& tree, const juce::Identifier&)
+{
+    treeChanged (tree);
+}
+
+void MagicProcessorState::valueTreeChildAdded (juce::ValueTree& tree, juce::ValueTree&)
+{
+    treeChanged (tree);
+}
+
+void MagicProcessorState::valueTreeChildRemoved (juce::ValueTree& tree, juce::ValueTree&, int)
+{
+    treeChanged (tree);
+}
+
+void MagicProcessorState::valueTreeChildOrderChanged (juce::ValueTree& tree, int, int)
+{
+    treeChanged (tree);
+}
+
+void MagicProcessorState::setCompressState (bool shouldCompress)
+{
+    compressState = shouldCompress;
+    markStateDirty();
+}
+
+void MagicProcessorState::setEditedGuiTree (const juce::ValueTree& tree)
+{
+    editedGuiTree.removeListener (this);
+    editedGuiTree = tree;
+    editedGuiTree.addListener (this);
+
+    editedGuiChanged = true;
+    triggerAsyncUpdate();
+}
+
+void MagicProcessorState::setGuiTreeFolder (const juce::File& folder)
+{
+    guiTreeFolder = folder;
+}
+
+juce::File MagicProcessorState::getGuiTreeFile (const juce::String& hash) const
+{
+    auto folder = guiTreeFolder;
+    if (folder == juce::File())
+        folder = juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+                     .getChildFile ("PluginGuiMagic")
+                     .getChildFile (juce::File::createLegalFileName (processor.getName()));
 
-    juce::MemoryOutputStream stream (destData, false);
-    newState.writeToStream (stream);
+    return folder.getChildFile (hash + ".magic");
+}
+
+void MagicProcessorState::handleAsyncUpdate()
+{
+    juce::String    hash;
+    juce::ValueTree embeddedGui;
+
+    {
+        const juce::ScopedLock lock (guiHashLock);
+        hash        = std::exchange (restoredGuiHash, {});
+        embeddedGui = std::exchange (restoredGuiTree, {});
+    }
+
+    if (embeddedGui.isValid())
+    {
+        if (editedGuiTree.isValid())
+            editedGuiTree.copyPropertiesAndChildrenFrom (embeddedGui, nullptr);
+    }
+    else if (hash.isNotEmpty())
+    {
+        loadEditedGuiTree (hash);
+    }
+
+    saveEditedGuiTree();
+}
+
+void MagicProcessorState::saveEditedGuiTree()
+{
+    if (! editedGuiTree.isValid() || ! editedGuiChanged)
+        return;
+
+    editedGuiChanged = false;
+
+    juce::MemoryBlock data;
+    {
+        juce::MemoryOutputStream stream (data, false);
+        editedGuiTree.writeToStream (stream);
+    }
+
+    const auto hash = juce::MD5 (data).toHexString();
+
+    auto file = getGuiTreeFile (hash);
+    auto createdFile = false;
+    if (! file.existsAsFile())
+    {
+        file.getParentDirectory().createDirectory();
+        createdFile = file.replaceWithData (data.getData(), data.getSize());
+    }
+
+    setEditedGuiHash (hash, createdFile);
+}
+
+void MagicProcessorState::setEditedGuiHash (const juce::String& hash, bool createdFile)
+{
+    juce::String unusedHash;
+
+    {
+        const juce::ScopedLock lock (guiHashLock);
+        if (hash == editedGuiHash)
+            return;
+
+        // a version written by this instance, that went into no saved state, isn't referenced anywhere
+        if (editedGuiHash == createdGuiHash && ! editedGuiHashSaved)
+            unusedHash = editedGuiHash;
+
+        editedGuiHash      = hash;
+        editedGuiHashSaved = false;
+        createdGuiHash     = createdFile ? hash : juce::String();
+    }
+
+    if (unusedHash.isNotEmpty())
+        getGuiTreeFile (unusedHash).deleteFile();
+
+    markStateDirty();
+}
+
+void MagicProcessorState::loadEditedGuiTree (const juce::String& hash)
+{
+    if (! editedGuiTree.isValid())
+        return;
+
+    {
+        const juce::ScopedLock lock (guiHashLock);
+        if (hash == editedGuiHash)
+            return;
+    }
+
+    juce::MemoryBlock data;
+    if (! getGuiTreeFile (hash).loadFileAsData (data))
+        return;
+
+    auto tree = juce::ValueTree::readFromData (data.getData(), data.getSize());
+    if (tree.hasType (IDs::magic))
+    {
+        editedGuiTree.copyPropertiesAndChildrenFrom (tree, nullptr);
+        editedGuiChanged = false;
+        setEditedGuiHash (hash, false);
+    }
 }
 
 void MagicProcessorState::setStateInformation (const void* data, int sizeInBytes, juce::AudioProcessorEditor* editor)
 {
-    auto tree = juce::ValueTree::readFromData (data, size_t (sizeInBytes));
+    const auto* bytes = static_cast<const juce::uint8*> (data);
+    const auto  isCompressed = sizeInBytes > 2 && bytes [0] == 0x1f && bytes [1] == 0x8b;
+
+    juce::ValueTree tree;
+    if (isCompressed)
+    {
+        juce::MemoryInputStream         stream (data, size_t (sizeInBytes), false);
+        juce::GZIPDecompressorInputStream unzipped (stream);
+        tree = juce::ValueTree::readFromStream (unzipped);
+    }
+    else
+    {
+        tree = juce::ValueTree::readFromData (data, size_t (sizeInBytes));
+    }
+
     if (tree.isValid() == false)
         return;
 
@@ -162,26 +445,51 @@ void MagicProcessorState::setStateInformation (const void* data, int sizeInBytes
     if (newState.getType() != tree.getType())
         return;
 
-    newState.copyPropertiesAndChildrenFrom (tree, nullptr);
+    {
+        // the GUI is loaded and applied on the message thread, older versions saved it in the state
+        const juce::ScopedLock lock (guiHashLock);
+        restoredGuiTree = tree.getChildWithName (IDs::magic);
+        restoredGuiHash = tree.getChildWithName (IDs::guiReference).getProperty (IDs::guiHash).toString();
+
+        if (restoredGuiTree.isValid())
+            tree.removeChild (restoredGuiTree, nullptr);
+    }
+
+    triggerAsyncUpdate();
+
+    // only the differences are applied, so only listeners of changed values are called
+    mergeValueTree (newState, tree);
 
     parameters.loadParameterValues (newState);
 
+    markStateDirty();
+
     if (editor)
     {
-        int width, height;
+        int width = 0, height = 0;
+        const auto hasSize = getLastEditorSize (width, height);
 
-        if (getLastEditorSize (width, height))
-        {
-            juce::Component::SafePointer safeEditor (editor);
-            juce::MessageManager::callAsync([safeEditor, width, height]
-                                            {
-                if (safeEditor)
-                    safeEditor->setSize (width, height);
-                                            });
-        }
+        // one refresh for the whole restore
+        juce::Component::SafePointer safeEditor (editor);
+        juce::MessageManager::callAsync([safeEditor, hasSize, width, height]
+                                        {
+            if (safeEditor == nullptr)
+                return;
+
+            if (hasSize)
+                safeEditor->setSize (width, height);
+
+            safeEditor->repaint();
+                                        });
     }
 }
 
+void MagicProcessorState::setUseParameterBlock (bool shouldUseBlock)
+{
+    parameters.setUseParameterBlock (shouldUseBlock);
+    markStateDirty();
+}
+
 void MagicProcessorState::updatePlayheadInformation (juce::AudioPlayHead* playhead)
 {
     if (playhead == nullptr)
@@ -216,7 +524,8 @@ void MagicProcessorState::setPlayheadUpdateFrequency (int frequency)
 
 void MagicProcessorState::processMidiBuffer (juce::MidiBuffer& buffer, int numSamples, bool injectIndirectEvents)
 {
-    getKeyboardState().processNextMidiBuffer (buffer, 0, numSamples, injectIndirectEvents);
+    juce::ignoreUnused (numSamples);
+    getNoteState().processMidiBuffer (buffer, injectIndirectEvents);
 
     midiMapper.processMidiBuffer (buffer);
 }
@@ -233,12 +542,22 @@ int MagicProcessorState::getLastController() const
 
 void MagicProcessorState::timerCallback()
 {
-    getPropertyAsValue ("playhead:bpm").setValue (bpm.load());
-    getPropertyAsValue ("playhead:timeInSeconds").setValue (timeInSeconds.load());
-    getPropertyAsValue ("playhead:timeSigNumerator").setValue (timeSigNumerator.load());
-    getPropertyAsValue ("playhead:timeSigDenominator").setValue (timeSigDenominator.load());
-    getPropertyAsValue ("playhead:isPlaying").setValue (isPlaying.load());
-    getPropertyAsValue ("playhead:isRecording").setValue (isRecording.load());
+    if (! bpmProperty.isValid())
+    {
+        bpmProperty                = getPropertyHandle<double> ("playhead:bpm");
+        timeInSecondsProperty      = getPropertyHandle<double> ("playhead:timeInSeconds");
+        timeSigNumeratorProperty   = getPropertyHandle<int> ("playhead:timeSigNumerator");
+        timeSigDenominatorProperty = getPropertyHandle<int> ("playhead:timeSigDenominator");
+        isPlayingProperty          = getPropertyHandle<bool> ("playhead:isPlaying");
+        isRecordingProperty        = getPropertyHandle<bool> ("playhead:isRecording");
+    }
+
+    bpmProperty.set (bpm.load());
+    timeInSecondsProperty.set (timeInSeconds.load());
+    timeSigNumeratorProperty.set (timeSigNumerator.load());
+    timeSigDenominatorProperty.set (timeSigDenominator.load());
+    isPlayingProperty.set (isPlaying.load());
+    isRecordingProperty.set (isRecording.load());
 }
 
 } // namespace foleys
@@ -39,13 +39,18 @@
 namespace foleys
 {
 
+class MagicGUIBuilder;
+
 /**
 The MagicProcessorState is a subclass of MagicGUIState, that adds AudioProcessor specific functionality.
  It allows for instance connecting to AudioProcessorParameters and supplies a default XML tree* of components
 built from the getParameterTree() from the AudioProcessor.
 */
 class MagicProcessorState : public MagicGUIState,
-                            private juce::Timer
+                            private juce::Timer,
+                            private juce::AsyncUpdater,
+                            private juce::ValueTree::Listener,
+                            private juce::AudioProcessorParameter::Listener
 {
 public:
     /**
@@ -82,6 +87,24 @@ public:
     void setLastEditorSize (int  width, int  height);
     bool getLastEditorSize (int& width, int& height);
 
+    /**
+     If enabled, the MagicGUIBuilder and all components survive closing the editor, so opening the
+     editor again only needs to attach the existing components. This trades memory for a fast reopen.
+     */
+    void setKeepEditorAlive (bool shouldKeepAlive);
+    bool getKeepEditorAlive() const;
+
+    /**
+     This is called by the MagicPluginEditor to hand over its builder when it is closed,
+     in case setKeepEditorAlive() was enabled.
+     */
+    void keepGUIBuilder (std::unique_ptr<MagicGUIBuilder> builder);
+
+    /**
+     Returns a builder kept from a previous editor, or nullptr.
+     */
+    std::unique_ptr<MagicGUIBuilder> takeKeptGUIBuilder();
+
     /**
      This method will serialise the plugin state from AudioProcessorValueTreeState for
      the host to save in the session
@@ -101,6 +124,31 @@ public:
      */
     void setStateInformation (const void* data, int sizeInBytes, juce::AudioProcessorEditor* editor = nullptr);
 
+    /**
+     Saves the parameter values as one compact binary block instead of a PARAM node per parameter.
+     This makes the state smaller and faster to save for plugins with many parameters. States in
+     either format can be restored.
+     */
+    void setUseParameterBlock (bool shouldUseBlock);
+
+    /**
+     Compresses the state with GZIP. Compressed and uncompressed states can always be restored.
+     */
+    void setCompressState (bool shouldCompress);
+
+    /**
+     This is called by the MagicPluginEditor, when the GUI can be edited. The edited GUI is kept between sessions,
+     but instead of adding it to every saved state, it is stored in a file named by its content hash in the
+     GUI tree folder. The state only refers to that hash.
+     */
+    void setEditedGuiTree (const juce::ValueTree& tree);
+
+    /**
+     Set the folder to store edited GUI trees. By default this is PluginGuiMagic/<plugin name>
+     in the user's application data directory.
+     */
+    void setGuiTreeFolder (const juce::File& folder);
+
     /**
      Returns a parameter for a parameter ID
      */
@@ -143,6 +191,45 @@ private:
 
     void timerCallback() override;
 
+    /**
+     The state is serialised again only if a parameter or the state tree changed since the last call
+     of getStateInformation(). Parameter changes are counted in parameterGeneration, because they
+     can happen on any thread, the changes of the state tree are counted in stateGeneration.
+     */
+    void markStateDirty();
+    void observeParameters();
+
+    void handleAsyncUpdate() override;
+
+    /**
+     Writes the edited GUI tree to the GUI tree folder, if it isn't there yet. This is called on the message
+     thread after the GUI was edited, getStateInformation() only reads the hash.
+     */
+    void saveEditedGuiTree();
+
+    /**
+     Sets the hash that is referenced in the state. The previous file is deleted, if this instance created it
+     and it was never saved in a state.
+     */
+    void setEditedGuiHash (const juce::String& hash, bool createdFile);
+
+    /**
+     Loads the GUI tree with that hash, unless it is the current one. Must be called on the message thread.
+     */
+    void loadEditedGuiTree (const juce::String& hash);
+
+    juce::File getGuiTreeFile (const juce::String& hash) const;
+
+    void parameterValueChanged (int parameterIndex, float newValue) override;
+    void parameterGestureChanged (int, bool) override {}
+
+    void treeChanged (const juce::ValueTree& tree);
+
+    void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override;
+    void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override;
+    void valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int) override;
+    void valueTreeChildOrderChanged (juce::ValueTree&, int, int) override;
+
     juce::AudioProcessor& processor;
 
     ParameterManager    parameters { processor };
@@ -155,6 +242,35 @@ private:
     std::atomic<bool>   isPlaying;
     std::atomic<bool>   isRecording;
 
+    PropertyHandle<double> bpmProperty;
+    PropertyHandle<int>    timeSigNumeratorProperty;
+    PropertyHandle<int>    timeSigDenominatorProperty;
+    PropertyHandle<double> timeInSecondsProperty;
+    PropertyHandle<bool>   isPlayingProperty;
+    PropertyHandle<bool>   isRecordingProperty;
+
+    bool                             keepEditorAlive = false;
+    std::unique_ptr<MagicGUIBuilder> keptBuilder;
+
+    std::atomic<juce::uint32>                stateGeneration { 1 };
+    std::atomic<juce::uint32>                parameterGeneration { 1 };
+    juce::CriticalSection                    cacheLock;
+    juce::uint32                             cachedGeneration = 0;
+    juce::uint32                             cachedParameterGeneration = 0;
+    juce::MemoryBlock                        cachedState;
+    std::set<juce::AudioProcessorParameter*> observedParameters;
+    bool                                     compressState = false;
+
+    juce::ValueTree                          editedGuiTree;
+    bool                                     editedGuiChanged = false;
+    juce::CriticalSection                    guiHashLock;
+    juce::String                             editedGuiHash;
+    juce::String                             createdGuiHash;
+    bool                                     editedGuiHashSaved = false;
+    juce::String                             restoredGuiHash;
+    juce::ValueTree                          restoredGuiTree;
+    juce::File                               guiTreeFolder;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicProcessorState)
 };
 
@@ -0,0 +1,218 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#include "foleys_MidiNoteState.h"
+
+namespace foleys
+{
+
+MidiNoteState::MidiNoteState (juce::MidiKeyboardState& guiStateToUse)
+  : guiState (guiStateToUse)
+{
+    guiState.addListener (this);
+}
+
+MidiNoteState::~MidiNoteState()
+{
+    stopTimer();
+    guiState.removeListener (this);
+}
+
+void MidiNoteState::processMidiBuffer (juce::MidiBuffer& buffer, bool injectIndirectEvents)
+{
+    // the notes are read in any case, so they are not played much later when the injection resumes
+    const auto scope = guiNotesFifo.read (guiNotesFifo.getNumReady());
+
+    if (injectIndirectEvents)
+    {
+        const auto now = juce::Time::getMillisecondCounter();
+
+        scope.forEach ([&] (int index)
+        {
+            const auto& event = guiNotes [size_t (index)];
+
+            // note offs are always sent, so no note is left hanging
+            if (event.isOn && now - event.time > maxNoteAge)
+                return;
+
+            buffer.addEvent (event.isOn ? juce::MidiMessage::noteOn (event.channel, event.note, event.velocity)
+                                        : juce::MidiMessage::noteOff (event.channel, event.note, event.velocity), 0);
+        });
+    }
+
+    for (const auto metadata : buffer)
+    {
+        const auto message = metadata.getMessage();
+
+        if (message.isNoteOn())
+            setNote (message.getChannel(), message.getNoteNumber(), true, message.getFloatVelocity());
+        else if (message.isNoteOff())
+            setNote (message.getChannel(), message.getNoteNumber(), false, message.getFloatVelocity());
+        else if (message.isAllNotesOff() || message.isAllSoundOff())
+            clearChannel (message.getChannel());
+    }
+}
+
+bool MidiNoteState::isNoteOn (int midiChannel, int noteNumber) const
+{
+    if (midiChannel < 1 || midiChannel > numChannels || ! juce::isPositiveAndBelow (noteNumber, numNotes))
+        return false;
+
+    const auto& word = noteBits [size_t ((midiChannel - 1) * 2 + noteNumber / 64)];
+    return (word.load (std::memory_order_relaxed) & (juce::uint64 (1) << (noteNumber % 64))) != 0;
+}
+
+bool MidiNoteState::isNoteOnForChannels (int midiChannelMask, int noteNumber) const
+{
+    for (int channel = 1; channel <= numChannels; ++channel)
+        if ((midiChannelMask & (1 << (channel - 1))) != 0 && isNoteOn (channel, noteNumber))
+            return true;
+
+    return false;
+}
+
+float MidiNoteState::getVelocity (int noteNumber) const
+{
+    if (! juce::isPositiveAndBelow (noteNumber, numNotes))
+        return 0.0f;
+
+    return velocities [size_t (noteNumber)].load (std::memory_order_relaxed);
+}
+
+void MidiNoteState::startMirroring (int refreshRateHz)
+{
+    ++numMirrorClients;
+
+    if (! isTimerRunning())
+        startTimerHz (refreshRateHz);
+}
+
+void MidiNoteState::stopMirroring()
+{
+    jassert (numMirrorClients > 0);
+
+    if (--numMirrorClients <= 0)
+    {
+        numMirrorClients = 0;
+        stopTimer();
+    }
+}
+
+void MidiNoteState::setNote (int midiChannel, int noteNumber, bool isOn, float velocity)
+{
+    if (midiChannel < 1 || midiChannel > numChannels || ! juce::isPositiveAndBelow (noteNumber, numNotes))
+        return;
+
+    auto& word = noteBits [size_t ((midiChannel - 1) * 2 + noteNumber / 64)];
+    const auto bit = juce::uint64 (1) << (noteNumber % 64);
+
+    if (isOn)
+    {
+        velocities [size_t (noteNumber)].store (velocity, std::memory_order_relaxed);
+        word.fetch_or (bit);
+    }
+    else
+    {
+        word.fetch_and (~bit);
+    }
+
+    ++changes;
+}
+
+void MidiNoteState::clearChannel (int midiChannel)
+{
+    if (midiChannel < 1 || midiChannel > numChannels)
+        return;
+
+    noteBits [size_t ((midiChannel - 1) * 2)].store (0);
+    noteBits [size_t ((midiChannel - 1) * 2 + 1)].store (0);
+    ++changes;
+}
+
+void MidiNoteState::pushNote (int midiChannel, int noteNumber, bool isOn, float velocity)
+{
+    // if the audio thread doesn't collect the notes, new ones are dropped
+    const auto scope = guiNotesFifo.write (1);
+    scope.forEach ([&] (int index)
+    {
+        guiNotes [size_t (index)] = { midiChannel, noteNumber, isOn, velocity, juce::Time::getMillisecondCounter() };
+    });
+}
+
+void MidiNoteState::handleNoteOn (juce::MidiKeyboardState*, int midiChannel, int midiNoteNumber, float velocity)
+{
+    if (mirroring)
+        return;
+
+    setNote (midiChannel, midiNoteNumber, true, velocity);
+    pushNote (midiChannel, midiNoteNumber, true, velocity);
+}
+
+void MidiNoteState::handleNoteOff (juce::MidiKeyboardState*, int midiChannel, int midiNoteNumber, float velocity)
+{
+    if (mirroring)
+        return;
+
+    setNote (midiChannel, midiNoteNumber, false, velocity);
+    pushNote (midiChannel, midiNoteNumber, false, velocity);
+}
+
+void MidiNoteState::timerCallback()
+{
+    const auto currentChanges = changes.load();
+    if (currentChanges == mirroredChanges)
+        return;
+
+    mirroredChanges = currentChanges;
+
+    // the keyboard state calls its listeners here on the message thread, they must not send the notes back
+    const juce::ScopedValueSetter<bool> setter (mirroring, true);
+
+    for (int channel = 1; channel <= numChannels; ++channel)
+    {
+        for (int note = 0; note < numNotes; ++note)
+        {
+            const auto isOn = isNoteOn (channel, note);
+            if (isOn == guiState.isNoteOn (channel, note))
+                continue;
+
+            if (isOn)
+                guiState.noteOn (channel, note, getVelocity (note));
+            else
+                guiState.noteOff (channel, note, 0.0f);
+        }
+    }
+}
+
+} // namespace foleys
@@ -0,0 +1,124 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_events/juce_events.h>
+
+namespace foleys
+{
+
+/**
+ The MidiNoteState tracks the pressed notes without locks. The audio thread writes the notes from the
+ MidiBuffer into atomic bitsets, and the notes played in the GUI are sent to the audio thread through
+ a wait-free FIFO. The juce::MidiKeyboardState for the GUI widgets is only updated on the message thread.
+ */
+class MidiNoteState : private juce::MidiKeyboardState::Listener,
+                      private juce::Timer
+{
+public:
+    /**
+     @param guiState is the keyboard state the GUI widgets use. It is only accessed on the message thread.
+     */
+    explicit MidiNoteState (juce::MidiKeyboardState& guiState);
+    ~MidiNoteState() override;
+
+    /**
+     Call this from the audio thread. It adds the notes played in the GUI to the buffer,
+     if injectIndirectEvents is true, otherwise they are discarded. Note ons that waited longer
+     than maxNoteAge are dropped. Then it reads the notes from the buffer. It never locks.
+     */
+    void processMidiBuffer (juce::MidiBuffer& buffer, bool injectIndirectEvents);
+
+    bool isNoteOn (int midiChannel, int noteNumber) const;
+    bool isNoteOnForChannels (int midiChannelMask, int noteNumber) const;
+
+    /**
+     Returns the velocity of the last note on of that note number on any channel
+     */
+    float getVelocity (int noteNumber) const;
+
+    /**
+     Starts to copy the notes into the keyboard state for the GUI on each timer tick. Each widget showing
+     the notes calls this when it is created and stopMirroring() when it goes away.
+     */
+    void startMirroring (int refreshRateHz = 30);
+
+    /**
+     Stops copying the notes, once the last widget that called startMirroring() stopped it.
+     */
+    void stopMirroring();
+
+private:
+    void handleNoteOn (juce::MidiKeyboardState*, int midiChannel, int midiNoteNumber, float velocity) override;
+    void handleNoteOff (juce::MidiKeyboardState*, int midiChannel, int midiNoteNumber, float velocity) override;
+
+    void timerCallback() override;
+
+    void setNote (int midiChannel, int noteNumber, bool isOn, float velocity);
+    void clearChannel (int midiChannel);
+    void pushNote (int midiChannel, int noteNumber, bool isOn, float velocity);
+
+    static constexpr int numChannels = 16;
+    static constexpr int numNotes    = 128;
+    static constexpr int fifoSize    = 256;
+
+    static constexpr juce::uint32 maxNoteAge = 500;
+
+    struct NoteEvent
+    {
+        int          channel  = 1;
+        int          note     = 0;
+        bool         isOn     = false;
+        float        velocity = 0.0f;
+        juce::uint32 time     = 0;
+    };
+
+    juce::MidiKeyboardState& guiState;
+
+    std::array<std::atomic<juce::uint64>, numChannels * 2> noteBits {};
+    std::array<std::atomic<float>, numNotes>               velocities {};
+    std::atomic<juce::uint32>                              changes { 0 };
+    juce::uint32                                           mirroredChanges = 0;
+    bool                                                   mirroring = false;
+    int                                                    numMirrorClients = 0;
+
+    juce::AbstractFifo                  guiNotesFifo { fifoSize };
+    std::array<NoteEvent, fifoSize>     guiNotes;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiNoteState)
+};
+
+} // namespace foleys
@@ -41,6 +41,7 @@ namespace IDs
     static juce::String mappings  { "mappings" };
     static juce::String mapping   { "mapping" };
     static juce::String cc        { "cc" };
+    static juce::String channel   { "channel" };
 }
 
 MidiParameterMapper::MidiParameterMapper (MagicProcessorState& s) : state (s)
@@ -51,38 +52,57 @@ MidiParameterMapper::MidiParameterMapper (MagicProcessorState& s) : state (s)
 MidiParameterMapper::~MidiParameterMapper()
 {
     settings->settings.removeListener (this);
+
+    retiredTables.push_back ({ std::unique_ptr<MappingTable> (currentTable.exchange (nullptr)), 0 });
+    deleteRetiredTables (true);
 }
 
 void MidiParameterMapper::processMidiBuffer (juce::MidiBuffer& buffer)
 {
-    auto isLocked = mappingLock.tryEnter();
+    ++audioEpoch;
+    auto* table = currentTable.load();
 
     for (auto m : buffer)
     {
-        if (m.getMessage().isController())
+        const auto& message = m.getMessage();
+        if (! message.isController())
+            continue;
+
+        auto number = message.getControllerNumber();
+        lastController.store (number);
+
+        if (table == nullptr)
+            continue;
+
+        const auto value = message.getControllerValue() / 127.0f;
+        const auto cell  = (message.getChannel() - 1) * MappingTable::numControllers + number;
+
+        for (auto index : table->targets [size_t (cell)])
+        {
+            if (table->pendingValues [size_t (index)] < 0.0f)
+                table->touched.push_back (index);
+
+            table->pendingValues [size_t (index)] = value;
+        }
+    }
+
+    if (table != nullptr)
+    {
+        // the host is notified once per parameter with the last value in this block
+        for (auto index : table->touched)
         {
-            auto number = m.getMessage().getControllerNumber();
-            auto value  = m.getMessage().getControllerValue() / 127.0f;
-            lastController.store (number);
-
-            if (isLocked)
-            {
-                auto bin = midiMapper.find (number);
-                if (bin == midiMapper.end())
-                    continue;
-
-                for (auto p : bin->second)
-                {
-                    p->beginChangeGesture();
-                    p->setValueNotifyingHost (value);
-                    p->endChangeGesture();
-                }
-            }
+            auto* parameter = table->parameters [size_t (index)];
+            parameter->beginChangeGesture();
+            parameter->setValueNotifyingHost (table->pendingValues [size_t (index)]);
+            parameter->endChangeGesture();
+
+            table->pendingValues [size_t (index)] = -1.0f;
         }
+
+        table->touched.clear();
     }
 
-    if (isLocked)
-        mappingLock.exit();
+    ++audioEpoch;
 }
 
 void MidiParameterMapper::mapMidiController (int cc, const juce::String& parameterID)
@@ -143,24 +163,57 @@ void MidiParameterMapper::recreateMidiMapper()
     if (! mappings.isValid())
         return;
 
-    MidiMapping newMapping;
+    auto newTable = std::make_unique<MappingTable>();
+    std::map<juce::RangedAudioParameter*, int> indices;
 
     for (auto item : mappings)
     {
         int  ccNum   = item.getProperty (IDs::cc, -1);
+        int  channel = item.getProperty (IDs::channel, 0);
         auto paramID = item.getProperty (IDs::parameter, juce::String()).toString();
-        if (ccNum < 1 || paramID.isEmpty())
+        if (ccNum < 1 || ccNum >= MappingTable::numControllers || paramID.isEmpty())
             continue;
 
         auto* parameter = state.getParameter (paramID);
         if (parameter == nullptr)
             continue;
 
-        newMapping [ccNum].push_back (parameter);
+        auto found = indices.find (parameter);
+        if (found == indices.end())
+        {
+            found = indices.insert ({ parameter, int (newTable->parameters.size()) }).first;
+            newTable->parameters.push_back (parameter);
+        }
+
+        // mappings without a channel respond to all channels
+        const auto omni         = channel < 1 || channel > MappingTable::numChannels;
+        const auto firstChannel = omni ? 1 : channel;
+        const auto lastChannel  = omni ? MappingTable::numChannels : channel;
+
+        for (int c = firstChannel; c <= lastChannel; ++c)
+            newTable->targets [size_t ((c - 1) * MappingTable::numControllers + ccNum)].push_back (found->second);
     }
 
-    juce::ScopedLock lock (mappingLock);
-    midiMapper = newMapping;
+    newTable->pendingValues.resize (newTable->parameters.size(), -1.0f);
+    newTable->touched.reserve (newTable->parameters.size());
+
+    auto* oldTable = currentTable.exchange (newTable.release());
+    retiredTables.push_back ({ std::unique_ptr<MappingTable> (oldTable), audioEpoch.load() });
+
+    deleteRetiredTables (false);
+}
+
+void MidiParameterMapper::deleteRetiredTables (bool force)
+{
+    // a table can be deleted, if the audio thread wasn't reading when it was replaced, or has finished that block since
+    const auto epoch = audioEpoch.load();
+
+    retiredTables.erase (std::remove_if (retiredTables.begin(), retiredTables.end(),
+                                         [force, epoch] (const auto& retired)
+                                         {
+                                             return force || (retired.epoch % 2) == 0 || retired.epoch != epoch;
+                                         }),
+                         retiredTables.end());
 }
 
 void MidiParameterMapper::valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&)
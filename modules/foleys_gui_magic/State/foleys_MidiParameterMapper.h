@@ -46,7 +46,8 @@ public:
     ~MidiParameterMapper() override;
 
     /*!
-     * Get Midi CC messages and set parameters accordingly
+     * Get Midi CC messages and set parameters accordingly. Only the last value of each
+     * parameter in the buffer is sent to the host. This is real-time safe.
      * @param buffer the last midi events
      */
     void processMidiBuffer (juce::MidiBuffer& buffer);
@@ -83,7 +84,26 @@ public:
     juce::ValueTree getMappingSettings();
 
 private:
+    /**
+     The mapping is a flat table by channel and CC number, that is replaced as a whole by recreateMidiMapper().
+     The audio thread only reads the current table, replaced tables are deleted once the audio thread
+     can't use them any more.
+     */
+    struct MappingTable
+    {
+        static constexpr int numChannels = 16;
+        static constexpr int numControllers = 128;
+
+        std::array<std::vector<int>, numChannels * numControllers> targets;
+        std::vector<juce::RangedAudioParameter*>                    parameters;
+
+        // used by the audio thread to send each parameter once per block
+        std::vector<float> pendingValues;
+        std::vector<int>   touched;
+    };
+
     void recreateMidiMapper();
+    void deleteRetiredTables (bool force);
 
     void valueTreeChildAdded (juce::ValueTree& parentTree,
                               juce::ValueTree& childWhichHasBeenAdded) override;
@@ -91,14 +111,20 @@ private:
     void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override;
 
 
-    using MidiMapping=std::map<int, std::vector<juce::RangedAudioParameter*>>;
-
     SharedApplicationSettings   settings;
-    juce::CriticalSection       mappingLock;
 
     MagicProcessorState&        state;
     std::atomic<int>            lastController { -1 };
-    MidiMapping                 midiMapper;
+
+    std::atomic<MappingTable*>  currentTable { nullptr };
+    std::atomic<juce::uint32>   audioEpoch   { 0 };   // odd while the audio thread is reading the table
+
+    struct RetiredTable
+    {
+        std::unique_ptr<MappingTable> table;
+        juce::uint32                  epoch;
+    };
+    std::vector<RetiredTable>   retiredTables;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiParameterMapper)
 };
@@ -41,6 +41,7 @@ namespace foleys
 juce::Identifier ParameterManager::nodeName  { "PARAM" };
 juce::Identifier ParameterManager::nodeId    { "id" };
 juce::Identifier ParameterManager::nodeValue { "value" };
+juce::Identifier ParameterManager::blockName { "parameter-block" };
 
 
 ParameterManager::ParameterManager (juce::AudioProcessor& p)
@@ -60,9 +61,27 @@ juce::RangedAudioParameter* ParameterManager::getParameter (const juce::String&
 
 void ParameterManager::updateParameterMap()
 {
-    for (auto* parameter : processor.getParameters())
+    const auto& processorParameters = processor.getParameters();
+
+    parameterList.clear();
+    parameterList.reserve (size_t (processorParameters.size()));
+
+    for (auto* parameter : processorParameters)
+    {
         if (auto* withID = dynamic_cast<juce::RangedAudioParameter*>(parameter))
+        {
             parameterLookup [withID->paramID] = withID;
+            parameterList.push_back (withID);
+        }
+    }
+
+    numProcessorParameters = processorParameters.size();
+}
+
+void ParameterManager::updateParameterMapIfNeeded()
+{
+    if (numProcessorParameters != processor.getParameters().size())
+        updateParameterMap();
 }
 
 juce::StringArray ParameterManager::getParameterNames() const
@@ -74,25 +93,55 @@ juce::StringArray ParameterManager::getParameterNames() const
     return names;
 }
 
+void ParameterManager::setUseParameterBlock (bool shouldUseBlock)
+{
+    useParameterBlock = shouldUseBlock;
+}
+
 void ParameterManager::saveParameterValues (juce::ValueTree& tree)
 {
-    updateParameterMap();
+    updateParameterMapIfNeeded();
 
-    for (auto& parameter : parameterLookup)
+    if (useParameterBlock)
+    {
+        saveParameterBlock (tree);
+        return;
+    }
+
+    // the nodes replace a block, otherwise it would be restored with outdated values
+    tree.removeProperty (blockName, nullptr);
+
+    // update the existing nodes in one pass, instead of searching a node for each parameter
+    std::set<juce::RangedAudioParameter*> written;
+
+    for (auto child : tree)
+    {
+        if (child.getType() != nodeName)
+            continue;
+
+        if (auto* parameter = getParameter (child.getProperty (nodeId).toString()))
+        {
+            child.setProperty (nodeValue, parameter->convertFrom0to1 (parameter->getValue()), nullptr);
+            written.insert (parameter);
+        }
+    }
+
+    for (auto* parameter : parameterList)
     {
-        auto node = tree.getChildWithProperty (nodeId, parameter.first);
-        if (node.isValid())
-            node.setProperty (nodeValue, parameter.second->convertFrom0to1 (parameter.second->getValue()), nullptr);
-        else
-            tree.appendChild ({ nodeName, {
-                { nodeId, parameter.second->paramID },
-                { nodeValue, parameter.second->convertFrom0to1 (parameter.second->getValue()) }}}, nullptr);
+        if (written.find (parameter) != written.end())
+            continue;
+
+        tree.appendChild ({ nodeName, {
+            { nodeId, parameter->paramID },
+            { nodeValue, parameter->convertFrom0to1 (parameter->getValue()) }}}, nullptr);
     }
 }
 
 void ParameterManager::loadParameterValues (juce::ValueTree& tree)
 {
-    updateParameterMap();
+    updateParameterMapIfNeeded();
+
+    auto hasNodes = false;
 
     for (const auto& child : tree)
     {
@@ -101,13 +150,65 @@ void ParameterManager::loadParameterValues (juce::ValueTree& tree)
             if (! (child.hasProperty (nodeId) && child.hasProperty (nodeValue)))
                 continue;
 
+            hasNodes = true;
+
             auto paramID = child.getProperty (nodeId).toString();
             if (auto* parameter = getParameter (paramID))
-                parameter->setValueNotifyingHost (parameter->convertTo0to1 (child.getProperty (nodeValue)));
+                setNormalisedValue (*parameter, parameter->convertTo0to1 (child.getProperty (nodeValue)));
         }
     }
+
+    // states saved by earlier versions can have both, then the block is the outdated one
+    if (! hasNodes)
+        loadParameterBlock (tree);
 }
 
+void ParameterManager::setNormalisedValue (juce::RangedAudioParameter& parameter, float value)
+{
+    // unchanged parameters don't need to notify the host and the attachments
+    if (parameter.getValue() != value)
+        parameter.setValueNotifyingHost (value);
+}
+
+void ParameterManager::saveParameterBlock (juce::ValueTree& tree)
+{
+    // the block replaces the PARAM nodes, otherwise they would be restored with outdated values
+    for (int i = tree.getNumChildren() - 1; i >= 0; --i)
+        if (tree.getChild (i).getType() == nodeName)
+            tree.removeChild (i, nullptr);
 
+    juce::MemoryBlock block;
+    {
+        juce::MemoryOutputStream stream (block, false);
+        stream.writeCompressedInt (int (parameterList.size()));
+
+        for (auto* parameter : parameterList)
+        {
+            stream.writeString (parameter->paramID);
+            stream.writeFloat (parameter->getValue());
+        }
+    }
+
+    tree.setProperty (blockName, block, nullptr);
+}
+
+void ParameterManager::loadParameterBlock (const juce::ValueTree& tree)
+{
+    const auto* block = tree.getProperty (blockName).getBinaryData();
+    if (block == nullptr)
+        return;
+
+    juce::MemoryInputStream stream (*block, false);
+    const auto numValues = stream.readCompressedInt();
+
+    for (int i = 0; i < numValues && ! stream.isExhausted(); ++i)
+    {
+        const auto paramID = stream.readString();
+        const auto value   = stream.readFloat();
+
+        if (auto* parameter = getParameter (paramID))
+            setNormalisedValue (*parameter, value);
+    }
+}
 
 } // namespace foleys
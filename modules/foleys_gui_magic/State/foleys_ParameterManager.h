@@ -47,18 +47,45 @@ public:
 
     void updateParameterMap();
 
+    /**
+     Writes the current parameter values into the tree. Existing PARAM nodes are updated, missing ones are added.
+     If the binary parameter block is enabled, the values are written as one block instead.
+     */
     void saveParameterValues (juce::ValueTree& tree);
 
+    /**
+     Sets the parameters from the PARAM nodes and the binary parameter block, if the tree has one.
+     */
     void loadParameterValues (juce::ValueTree& tree);
 
+    /**
+     If enabled, the values are saved as a compact binary block property instead of a PARAM node each.
+     Both formats can always be loaded.
+     */
+    void setUseParameterBlock (bool shouldUseBlock);
+
     static juce::Identifier nodeName;
     static juce::Identifier nodeId;
     static juce::Identifier nodeValue;
+    static juce::Identifier blockName;
 
 private:
+    /**
+     The parameters are only collected again, when the number of parameters of the processor changed
+     */
+    void updateParameterMapIfNeeded();
+
+    static void setNormalisedValue (juce::RangedAudioParameter& parameter, float value);
+
+    void saveParameterBlock (juce::ValueTree& tree);
+    void loadParameterBlock (const juce::ValueTree& tree);
+
     juce::AudioProcessor& processor;
 
     std::map<juce::String, juce::RangedAudioParameter*> parameterLookup;
+    std::vector<juce::RangedAudioParameter*>             parameterList;
+    int                                                  numProcessorParameters = -1;
+    bool                                                 useParameterBlock = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterManager)
 };
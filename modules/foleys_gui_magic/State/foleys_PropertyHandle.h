@@ -0,0 +1,141 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace foleys
+{
+
+/**
+ A PropertyHandle points to a property in the state of the MagicGUIState. The colon separated path
+ is parsed once and the node is kept, so reading and writing doesn't need to parse and walk the tree.
+ If the node is removed from the state, e.g. when restoring the state, the path is resolved again.
+
+ The value is converted using juce::VariantConverter<T>. It is only written, if it differs from the
+ current value, so listeners are not called needlessly.
+
+ Like the ValueTree, a PropertyHandle must only be used on the message thread.
+ */
+template <typename T>
+class PropertyHandle
+{
+public:
+    PropertyHandle() = default;
+
+    /**
+     @param rootToUse the node the path starts at
+     @param pathToProperty the colon separated node names, the last component is the property name
+     */
+    PropertyHandle (juce::ValueTree rootToUse, const juce::String& pathToProperty)
+      : root (std::move (rootToUse))
+    {
+        auto path = juce::StringArray::fromTokens (pathToProperty, ":", "");
+        path.removeEmptyStrings();
+
+        if (path.isEmpty())
+            return;
+
+        for (int i = 0; i < path.size() - 1; ++i)
+            nodeNames.add (path [i]);
+
+        property = path [path.size() - 1];
+        resolve();
+    }
+
+    bool isValid() const { return property.isValid() && root.isValid(); }
+
+    T get()
+    {
+        resolveIfNeeded();
+        return juce::VariantConverter<T>::fromVar (node.getProperty (property));
+    }
+
+    /**
+     Sets the property, if the value is different.
+     @return true, if the property was changed
+     */
+    bool set (const T& value)
+    {
+        resolveIfNeeded();
+        if (! node.isValid())
+            return false;
+
+        auto newValue = juce::VariantConverter<T>::toVar (value);
+        if (node.hasProperty (property) && node.getProperty (property) == newValue)
+            return false;
+
+        node.setProperty (property, std::move (newValue), nullptr);
+        return true;
+    }
+
+    /**
+     Returns a juce::Value to connect e.g. a Component. Note that this Value refers to the node at the time of calling.
+     */
+    juce::Value getValue()
+    {
+        resolveIfNeeded();
+        return node.getPropertyAsValue (property, nullptr);
+    }
+
+    const juce::Identifier& getPropertyID() const { return property; }
+
+private:
+    void resolveIfNeeded()
+    {
+        if (! node.isValid() || (node != root && ! node.isAChildOf (root)))
+            resolve();
+    }
+
+    void resolve()
+    {
+        if (! isValid())
+            return;
+
+        node = root;
+        for (const auto& name : nodeNames)
+            node = node.getOrCreateChildWithName (name, nullptr);
+
+        if (! node.hasProperty (property))
+            node.setProperty (property, {}, nullptr);
+    }
+
+    juce::ValueTree               root;
+    juce::ValueTree               node;
+    juce::Array<juce::Identifier> nodeNames;
+    juce::Identifier              property;
+};
+
+} // namespace foleys
@@ -60,6 +60,14 @@ void MagicLevelMeter::setLevelSource (MagicLevelSource* newSource)
     magicLevelSource = newSource;
 }
 
+void MagicLevelMeter::setPaused (bool shouldPause)
+{
+    if (shouldPause)
+        stopTimer();
+    else
+        startTimerHz (30);
+}
+
 void MagicLevelMeter::timerCallback()
 {
     repaint();
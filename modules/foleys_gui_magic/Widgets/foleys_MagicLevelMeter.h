@@ -67,6 +67,11 @@ public:
 
     void setLevelSource (MagicLevelSource* newSource);
 
+    /**
+     Stops repainting, e.g. while the meter is not shown.
+     */
+    void setPaused (bool shouldPause);
+
     void timerCallback() override;
 
     void lookAndFeelChanged() override;
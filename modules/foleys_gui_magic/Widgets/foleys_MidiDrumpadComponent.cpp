@@ -103,6 +103,10 @@ void MidiDrumpadComponent::resized()
 
 void MidiDrumpadComponent::timerCallback()
 {
+    for (auto& pad : pads)
+        if (pad->updateNoteState())
+            needsPaint = true;
+
     if (needsPaint)
     {
         needsPaint = false;
@@ -116,12 +120,16 @@ MidiDrumpadComponent::Pad::Pad (MidiDrumpadComponent& ownerToUse, int note)
   : owner (ownerToUse),
     noteNumber (note)
 {
-    owner.keyboardState.addListener (this);
 }
 
-MidiDrumpadComponent::Pad::~Pad()
+bool MidiDrumpadComponent::Pad::updateNoteState()
 {
-    owner.keyboardState.removeListener (this);
+    const auto down = owner.keyboardState.isNoteOnForChannels (0xffff, noteNumber);
+    if (down == isDown)
+        return false;
+
+    isDown = down;
+    return true;
 }
 
 void MidiDrumpadComponent::Pad::paint (juce::Graphics& g)
@@ -163,30 +171,4 @@ void MidiDrumpadComponent::Pad::mouseUp (const juce::MouseEvent& event)
     owner.needsPaint = true;
 }
 
-void MidiDrumpadComponent::Pad::handleNoteOn (juce::MidiKeyboardState* source,
-                                              int midiChannel, int midiNoteNumber, float velocity)
-{
-    juce::ignoreUnused (source, midiChannel, velocity);
-
-    if (midiNoteNumber != noteNumber)
-        return;
-
-    isDown = true;
-
-    owner.needsPaint = true;
-}
-
-void MidiDrumpadComponent::Pad::handleNoteOff (juce::MidiKeyboardState* source,
-                                               int midiChannel, int midiNoteNumber, float velocity)
-{
-    juce::ignoreUnused (source, midiChannel, velocity);
-
-    if (midiNoteNumber != noteNumber)
-        return;
-
-    isDown = false;
-
-    owner.needsPaint = true;
-}
-
 } // namespace foleys
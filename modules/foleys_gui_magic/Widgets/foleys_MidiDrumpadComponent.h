@@ -70,12 +70,10 @@ public:
 
     void timerCallback() override;
 
-    class Pad : public juce::Component,
-                public juce::MidiKeyboardState::Listener
+    class Pad : public juce::Component
     {
     public:
         Pad (MidiDrumpadComponent& owner, int noteNumber);
-        ~Pad() override;
 
         void paint (juce::Graphics& g) override;
 
@@ -83,16 +81,15 @@ public:
         void mouseDrag (const juce::MouseEvent& event) override;
         void mouseUp (const juce::MouseEvent& event) override;
 
-        void handleNoteOn (juce::MidiKeyboardState* source,
-                           int midiChannel, int midiNoteNumber, float velocity) override;
-
-        void handleNoteOff (juce::MidiKeyboardState* source,
-                            int midiChannel, int midiNoteNumber, float velocity) override;
+        /**
+         Reads the note from the keyboard state. Returns true, if the pad needs repainting.
+         */
+        bool updateNoteState();
 
     private:
         MidiDrumpadComponent& owner;
         int                   noteNumber = 60;
-        std::atomic_bool      isDown { false };
+        bool                  isDown = false;
         juce::Point<int>      lastPos;
         float                 pressure = 0.0f;
 
@@ -42,6 +42,14 @@ void MidiLearnComponent::setMagicProcessorState (MagicProcessorState* state)
     startTimerHz (4);
 }
 
+void MidiLearnComponent::setPaused (bool shouldPause)
+{
+    if (shouldPause)
+        stopTimer();
+    else if (processorState != nullptr)
+        startTimerHz (4);
+}
+
 void MidiLearnComponent::paint (juce::Graphics& g)
 {
     if (processorState)
@@ -53,6 +53,11 @@ public:
 
     void setMagicProcessorState (MagicProcessorState* state);
 
+    /**
+     Stops polling the last controller, e.g. while the component is not shown.
+     */
+    void setPaused (bool shouldPause);
+
     void paint (juce::Graphics& g) override;
     void mouseDrag (const juce::MouseEvent& event) override;
 
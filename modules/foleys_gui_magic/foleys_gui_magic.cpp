@@ -40,11 +40,13 @@
 #include "BinaryData.h"
 #endif
 
+#include "General/foleys_SettingsFileWatcher.cpp"
 #include "General/foleys_ApplicationSettings.cpp"
 #include "General/foleys_MagicGUIBuilder.cpp"
 #include "General/foleys_MagicPluginEditor.cpp"
 #include "General/foleys_MagicProcessor.cpp"
 #include "General/foleys_Resources.cpp"
+#include "General/foleys_ResourceImageCache.cpp"
 #include "General/foleys_MagicJUCEFactories.cpp"
 
 #include "State/foleys_MagicGUIState.cpp"
@@ -52,6 +54,8 @@
 #include "State/foleys_ParameterManager.cpp"
 #include "State/foleys_MidiParameterMapper.cpp"
 #include "State/foleys_RadioButtonManager.cpp"
+#include "State/foleys_MidiNoteState.cpp"
+#include "State/foleys_AudioToGuiChannels.cpp"
 
 #include "Layout/foleys_GradientBackground.cpp"
 #include "Layout/foleys_Stylesheet.cpp"
@@ -77,6 +81,7 @@
 #include "LookAndFeels/foleys_JuceLookAndFeels.cpp"
 #include "LookAndFeels/foleys_LookAndFeel.cpp"
 #include "LookAndFeels/foleys_Skeuomorphic.cpp"
+#include "LookAndFeels/foleys_LookAndFeelRegistry.cpp"
 
 #if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
 
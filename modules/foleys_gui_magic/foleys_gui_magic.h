@@ -93,17 +93,21 @@
 #endif
 
 #include "General/foleys_StringDefinitions.h"
+#include "General/foleys_SettingsFileWatcher.h"
 #include "General/foleys_ApplicationSettings.h"
 #include "General/foleys_SettableProperties.h"
 #include "General/foleys_Resources.h"
+#include "General/foleys_ResourceImageCache.h"
 
 #include "Helpers/foleys_ScopedInterProcessLock.h"
 #include "Helpers/foleys_PopupMenuHelper.h"
 #include "Helpers/foleys_MouseLambdas.h"
 #include "Helpers/foleys_ParameterAttachment.h"
 #include "Helpers/foleys_AtomicValueAttachment.h"
+#include "Helpers/foleys_ImageLayerCache.h"
 #include "Helpers/foleys_Conversions.h"
 #include "Helpers/foleys_DefaultGuiTrees.h"
+#include "Helpers/foleys_ValueTreeHelpers.h"
 
 #include "Layout/foleys_GradientBackground.h"
 #include "Layout/foleys_BoxModel.h"
@@ -116,6 +120,7 @@
 #include "LookAndFeels/foleys_JuceLookAndFeels.h"
 #include "LookAndFeels/foleys_LookAndFeel.h"
 #include "LookAndFeels/foleys_Skeuomorphic.h"
+#include "LookAndFeels/foleys_LookAndFeelRegistry.h"
 
 #include "Visualisers/foleys_MagicLevelSource.h"
 #include "Visualisers/foleys_MagicPlotSource.h"
@@ -131,6 +136,9 @@
 #include "Widgets/foleys_MidiLearnComponent.h"
 #include "Widgets/foleys_MidiDrumpadComponent.h"
 
+#include "State/foleys_PropertyHandle.h"
+#include "State/foleys_AudioToGuiChannels.h"
+#include "State/foleys_MidiNoteState.h"
 #include "State/foleys_RadioButtonManager.h"
 #include "State/foleys_ParameterManager.h"
 #include "State/foleys_MidiParameterMapper.h"